@@ -0,0 +1,154 @@
+#include <QFile>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QVector>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include <mavsdk/mavsdk.h>
+#include <mavsdk/plugins/mavlink_direct/mavlink_direct.h>
+#include "Extern/XmlToMavSDK.h"
+#include "Private/QMavsdkTextCatalog.h"
+#include "SwarmVehicle.h"
+
+/**
+ * @brief 文本目录与扩展命令表：类型文本查询、XML 解析、命令发送
+ */
+namespace {
+
+/**
+ * @brief 生成含 count 条 MAV_CMD 的方言文件，每条带 7 个参数
+ */
+QString writeCommandXml(const QTemporaryDir &dir, int count)
+{
+    QByteArray xml("<?xml version=\"1.0\"?>\n<mavlink>\n<enums>\n"
+                   "<enum name=\"MAV_CMD\">\n");
+    for (int index = 0; index < count; ++index) {
+        xml += QByteArray("<entry value=\"") +
+               QByteArray::number(31000 + index) +
+               "\" name=\"MAV_CMD_BENCH_" + QByteArray::number(index) +
+               "\">\n<description>Benchmark command.</description>\n";
+        for (int param = 1; param <= 7; ++param) {
+            xml += "<param index=\"" + QByteArray::number(param) +
+                   "\" label=\"P" + QByteArray::number(param) +
+                   "\">Value.</param>\n";
+        }
+        xml += "</entry>\n";
+    }
+    xml += "</enum>\n</enums>\n</mavlink>\n";
+
+    const QString path =
+        dir.filePath(QStringLiteral("bench_%1.xml").arg(count));
+    QFile file(path);
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(xml);
+    }
+    return path;
+}
+
+void BM_TextCatalogHit(benchmark::State &state)
+{
+    int value = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            QMavsdkTextCatalog::text(QMavsdkTextCatalog::Vehicle, value));
+        value = (value + 1) % 20;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TextCatalogHit);
+
+void BM_TextCatalogByName(benchmark::State &state)
+{
+    int value = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            QMavsdkTextCatalog::text(u"vehicle", value));
+        value = (value + 1) % 20;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TextCatalogByName);
+
+void BM_TextCatalogFallback(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            QMavsdkTextCatalog::text(u"bench_missing_section", 42));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TextCatalogFallback);
+
+void BM_XmlLoad(benchmark::State &state)
+{
+    QTemporaryDir dir;
+    const QString path =
+        writeCommandXml(dir, static_cast<int>(state.range(0)));
+    XmlToMavSDK extension;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(extension.loadXml(path));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_XmlLoad)->Arg(50)->Arg(500)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief 经 Raw 连接注入心跳，等待 MAVSDK 发现一架飞机
+ */
+std::shared_ptr<mavsdk::System> discoverSystem(mavsdk::Mavsdk &mavsdk)
+{
+    SwarmVehicle vehicle(1, 0);
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        std::vector<std::uint8_t> heartbeat;
+        vehicle.appendHeartbeat(heartbeat);
+        mavsdk.pass_received_raw_bytes(
+            reinterpret_cast<const char *>(heartbeat.data()),
+            heartbeat.size());
+        for (const auto &system : mavsdk.systems()) {
+            if (system && system->is_connected()) {
+                return system;
+            }
+        }
+        QThread::msleep(20);
+    }
+    return nullptr;
+}
+
+void BM_XmlSendCmd(benchmark::State &state)
+{
+    QTemporaryDir dir;
+    const XmlToMavSDK extension(writeCommandXml(dir, 50));
+
+    mavsdk::Mavsdk mavsdk(
+        mavsdk::Mavsdk::Configuration(mavsdk::ComponentType::GroundStation));
+    mavsdk.add_any_connection("raw://");
+    std::atomic<quint64> sentBytes{0};
+    const auto handle = mavsdk.subscribe_raw_bytes_to_be_sent(
+        [&sentBytes](const char *, size_t length) {
+            sentBytes.fetch_add(length);
+        });
+
+    const std::shared_ptr<mavsdk::System> system = discoverSystem(mavsdk);
+    if (!system) {
+        mavsdk.unsubscribe_raw_bytes_to_be_sent(handle);
+        state.SkipWithError("simulated vehicle was not discovered");
+        return;
+    }
+    mavsdk::MavlinkDirect mavlinkDirect(*system);
+    const QString name = QStringLiteral("MAV_CMD_BENCH_7");
+    const QVector<float> params{1.0f, 2.5f, 0.0f, 0.0f, 39.0f, 116.0f, 50.0f};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            extension.sendCmd(mavlinkDirect, *system, name, 1, params));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes"] = static_cast<double>(sentBytes.load());
+    mavsdk.unsubscribe_raw_bytes_to_be_sent(handle);
+}
+BENCHMARK(BM_XmlSendCmd);
+
+} // namespace
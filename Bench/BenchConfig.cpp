@@ -0,0 +1,76 @@
+#include <QSettings>
+#include <QTemporaryDir>
+#include <benchmark/benchmark.h>
+#include "QGCSConfig.h"
+
+/**
+ * @brief 配置热路径：每个遥测样本读取一组运动判定阈值
+ *
+ * BM_ConfigSettingsLookup 复现改为快照前的 getter 路径（每项一次
+ * QSettings::value()），BM_ConfigSnapshotLookup 走当前的快照 getter。
+ */
+namespace {
+
+void BM_ConfigSettingsLookup(benchmark::State &state)
+{
+    QTemporaryDir dir;
+    QSettings settings(dir.filePath(QStringLiteral("bench.ini")),
+                       QSettings::IniFormat);
+    settings.setValue("Motion/StartHorizontalSpeedMS", 0.7);
+    settings.setValue("Motion/StartVerticalSpeedMS", 0.5);
+    settings.setValue("Motion/StopHorizontalSpeedMS", 0.25);
+    settings.setValue("Motion/StopVerticalSpeedMS", 0.2);
+    settings.setValue("Motion/StartSampleCount", 2);
+    settings.setValue("Motion/StopSampleCount", 5);
+    settings.sync();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            settings.value("Motion/StartHorizontalSpeedMS", 0.7).toDouble());
+        benchmark::DoNotOptimize(
+            settings.value("Motion/StartVerticalSpeedMS", 0.5).toDouble());
+        benchmark::DoNotOptimize(
+            settings.value("Motion/StopHorizontalSpeedMS", 0.25).toDouble());
+        benchmark::DoNotOptimize(
+            settings.value("Motion/StopVerticalSpeedMS", 0.2).toDouble());
+        benchmark::DoNotOptimize(
+            settings.value("Motion/StartSampleCount", 2).toInt());
+        benchmark::DoNotOptimize(
+            settings.value("Motion/StopSampleCount", 5).toInt());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigSettingsLookup);
+
+void BM_ConfigSnapshotLookup(benchmark::State &state)
+{
+    const QGCSConfig *config = QGCSConfig::instance();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config->motionStartHorizontalSpeedMS());
+        benchmark::DoNotOptimize(config->motionStartVerticalSpeedMS());
+        benchmark::DoNotOptimize(config->motionStopHorizontalSpeedMS());
+        benchmark::DoNotOptimize(config->motionStopVerticalSpeedMS());
+        benchmark::DoNotOptimize(config->motionStartSampleCount());
+        benchmark::DoNotOptimize(config->motionStopSampleCount());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigSnapshotLookup);
+
+/**
+ * @brief XmlToMavSDK::sendCmd 每条命令读取的地面站身份
+ */
+void BM_ConfigStationIdentity(benchmark::State &state)
+{
+    const QGCSConfig *config = QGCSConfig::instance();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config->stationId());
+        benchmark::DoNotOptimize(config->stationComponentId());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigStationIdentity);
+
+} // namespace
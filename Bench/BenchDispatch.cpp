@@ -0,0 +1,115 @@
+#include <QCoreApplication>
+#include <QObject>
+#include <QPointer>
+#include <benchmark/benchmark.h>
+#include "Plat/Private/QAutopilotTelemetrySnapshot.h"
+#include "Private/QQueuedInvoke.h"
+
+/**
+ * @brief 遥测槽投递开销：按名称投递 / 类型化投递 / 快照合并
+ *
+ * 每轮在调用线程投递一批样本，再派发本对象的排队事件，
+ * 统计的是「投递 + 派发」的单样本成本。
+ */
+namespace {
+
+class QBenchTelemetryReceiver : public QObject
+{
+    Q_OBJECT
+
+public:
+    quint64 received{0};
+    double lastLongitude{0.0};
+
+public slots:
+    void positionUpdate(double dLon, double dLat, float dH,
+                        float relativeAltitudeM)
+    {
+        ++received;
+        lastLongitude = dLon;
+        benchmark::DoNotOptimize(dLat);
+        benchmark::DoNotOptimize(dH);
+        benchmark::DoNotOptimize(relativeAltitudeM);
+    }
+};
+
+void BM_DispatchByName(benchmark::State &state)
+{
+    QBenchTelemetryReceiver receiver;
+    const QPointer<QBenchTelemetryReceiver> target(&receiver);
+    const int batch = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < batch; ++i) {
+            QMetaObject::invokeMethod(
+                target, "positionUpdate", Qt::QueuedConnection,
+                Q_ARG(double, 116.0 + i * 1e-7), Q_ARG(double, 39.0),
+                Q_ARG(float, 50.0f), Q_ARG(float, 10.0f));
+        }
+        QCoreApplication::sendPostedEvents(&receiver);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+    state.counters["delivered"] = static_cast<double>(receiver.received);
+}
+BENCHMARK(BM_DispatchByName)->Arg(1)->Arg(64);
+
+void BM_DispatchTyped(benchmark::State &state)
+{
+    QBenchTelemetryReceiver receiver;
+    const QPointer<QBenchTelemetryReceiver> target(&receiver);
+    const int batch = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < batch; ++i) {
+            QQueuedInvoke::post(
+                target, &QBenchTelemetryReceiver::positionUpdate,
+                116.0 + i * 1e-7, 39.0, 50.0f, 10.0f);
+        }
+        QCoreApplication::sendPostedEvents(&receiver);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+    state.counters["delivered"] = static_cast<double>(receiver.received);
+}
+BENCHMARK(BM_DispatchTyped)->Arg(1)->Arg(64);
+
+void BM_DispatchSnapshot(benchmark::State &state)
+{
+    QBenchTelemetryReceiver receiver;
+    const QPointer<QBenchTelemetryReceiver> target(&receiver);
+    QAutopilotTelemetrySnapshot snapshot;
+    const int batch = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < batch; ++i) {
+            mavsdk::Telemetry::Position position;
+            position.longitude_deg = 116.0 + i * 1e-7;
+            position.latitude_deg = 39.0;
+            position.absolute_altitude_m = 50.0f;
+            position.relative_altitude_m = 10.0f;
+            snapshot.position.store(position);
+            if (snapshot.markDirty(TelemetryPosition)) {
+                QMetaObject::invokeMethod(
+                    &receiver,
+                    [target, &snapshot]() {
+                        snapshot.flushPending = false;
+                        if (snapshot.dirty.exchange(0) & TelemetryPosition) {
+                            const auto latest = snapshot.position.load();
+                            target->positionUpdate(
+                                latest.longitude_deg, latest.latitude_deg,
+                                latest.absolute_altitude_m,
+                                latest.relative_altitude_m);
+                        }
+                    },
+                    Qt::QueuedConnection);
+            }
+        }
+        QCoreApplication::sendPostedEvents(&receiver);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+    state.counters["delivered"] = static_cast<double>(receiver.received);
+}
+BENCHMARK(BM_DispatchSnapshot)->Arg(1)->Arg(64);
+
+} // namespace
+
+#include "BenchDispatch.moc"
@@ -0,0 +1,99 @@
+#include <QList>
+#include <benchmark/benchmark.h>
+#include "AirLine/QAirLine.h"
+#include "AirLine/QMissionPoint.h"
+#include "Plat/Private/QMavsdkTypeMap.h"
+
+/**
+ * @brief 航线数据路径：QAirLine 读写与 MAVSDK 任务项转换
+ */
+namespace {
+
+QList<QMissionPoint> makeMissionPoints(int count)
+{
+    QList<QMissionPoint> points;
+    points.reserve(count);
+    for (int index = 0; index < count; ++index) {
+        const auto action = static_cast<QMissionPoint::Action>(
+            index % (QMissionPoint::LandAction + 1));
+        points.append(QMissionPoint(
+            QGpsPosition(116.0 + index * 1e-4, 39.0 + index * 1e-4, 50.0f),
+            action, 2.0, 8.0, index % 2 == 0));
+    }
+    return points;
+}
+
+void BM_AirLineSetMissionPoints(benchmark::State &state)
+{
+    const QList<QMissionPoint> points =
+        makeMissionPoints(static_cast<int>(state.range(0)));
+    QAirLine airLine;
+
+    for (auto _ : state) {
+        airLine.setMissionPoints(points);
+        /// 再写入空航线，保证下一轮仍然是一次真实的变更
+        airLine.setMissionPoints({});
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AirLineSetMissionPoints)->Arg(16)->Arg(256);
+
+void BM_AirLineSetMissionPointsUnchanged(benchmark::State &state)
+{
+    const int count = static_cast<int>(state.range(0));
+    QAirLine airLine;
+    airLine.setMissionPoints(makeMissionPoints(count));
+    /// 内容相同但不共享存储，测量逐点比较去重的成本
+    const QList<QMissionPoint> points = makeMissionPoints(count);
+
+    for (auto _ : state) {
+        airLine.setMissionPoints(points);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AirLineSetMissionPointsUnchanged)->Arg(16)->Arg(256);
+
+void BM_AirLineWaypoints(benchmark::State &state)
+{
+    QAirLine airLine;
+    airLine.setMissionPoints(makeMissionPoints(static_cast<int>(state.range(0))));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(airLine.waypoints());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AirLineWaypoints)->Arg(16)->Arg(256);
+
+void BM_MissionItemFromPoint(benchmark::State &state)
+{
+    const QList<QMissionPoint> points = makeMissionPoints(256);
+
+    for (auto _ : state) {
+        for (const QMissionPoint &point : points) {
+            benchmark::DoNotOptimize(
+                MavsdkTypeMap::mavsdkItemFromMissionPoint(point));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_MissionItemFromPoint);
+
+void BM_MissionPointFromItem(benchmark::State &state)
+{
+    std::vector<mavsdk::Mission::MissionItem> items;
+    for (const QMissionPoint &point : makeMissionPoints(256)) {
+        items.push_back(MavsdkTypeMap::mavsdkItemFromMissionPoint(point));
+    }
+
+    for (auto _ : state) {
+        for (const auto &item : items) {
+            benchmark::DoNotOptimize(MavsdkTypeMap::missionPointFromMavsdk(item));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(items.size()));
+}
+BENCHMARK(BM_MissionPointFromItem);
+
+} // namespace
@@ -0,0 +1,121 @@
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QObject>
+#include <QPointer>
+#include <array>
+#include <benchmark/benchmark.h>
+#include "Link/Private/QRawPacketRing.h"
+#include "Private/QQueuedInvoke.h"
+
+/**
+ * @brief Raw 链路待发送路径吞吐：逐包 QByteArray 排队 / 环形缓冲区批量取出
+ *
+ * 每轮模拟 1 秒 10k 包的流量：100 个 10 ms 节拍，每个节拍 100 个
+ * MAVLink 包，节拍末尾派发排队事件（相当于链路线程被调度一次）。
+ */
+namespace {
+
+constexpr int PacketsPerSecond = 10000;
+constexpr int TicksPerSecond = 100;
+constexpr int PacketsPerTick = PacketsPerSecond / TicksPerSecond;
+
+class QBenchRawSink : public QObject
+{
+    Q_OBJECT
+
+public:
+    quint64 bytes{0};
+    quint64 packets{0};
+
+    void write(const char *data, int length)
+    {
+        benchmark::DoNotOptimize(data);
+        bytes += static_cast<quint64>(length);
+        ++packets;
+    }
+
+public slots:
+    void legacyReceived(const QByteArray &data)
+    {
+        write(data.constData(), static_cast<int>(data.size()));
+    }
+};
+
+std::array<char, 280> makePacket()
+{
+    std::array<char, 280> packet{};
+    for (std::size_t index = 0; index < packet.size(); ++index) {
+        packet[index] = static_cast<char>(index);
+    }
+    return packet;
+}
+
+int packetLength(int sequence)
+{
+    /// HEARTBEAT / ATTITUDE / GLOBAL_POSITION_INT 等典型长度交替
+    static constexpr int Lengths[] = {21, 40, 40, 40, 51, 43, 12};
+    return Lengths[sequence % 7];
+}
+
+void BM_RawLinkLegacyQueue(benchmark::State &state)
+{
+    QBenchRawSink sink;
+    const QPointer<QBenchRawSink> target(&sink);
+    const auto packet = makePacket();
+
+    for (auto _ : state) {
+        for (int tick = 0; tick < TicksPerSecond; ++tick) {
+            for (int index = 0; index < PacketsPerTick; ++index) {
+                QByteArray data(packet.data(), packetLength(index));
+                QMetaObject::invokeMethod(
+                    target, "legacyReceived", Qt::QueuedConnection,
+                    Q_ARG(QByteArray, data));
+            }
+            QCoreApplication::sendPostedEvents(&sink);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PacketsPerSecond);
+    state.SetBytesProcessed(static_cast<int64_t>(sink.bytes));
+}
+BENCHMARK(BM_RawLinkLegacyQueue)->Unit(benchmark::kMillisecond);
+
+void BM_RawLinkRing(benchmark::State &state)
+{
+    QBenchRawSink sink;
+    QRawPacketRing ring;
+    const auto packet = makePacket();
+    quint64 notifications = 0;
+
+    for (auto _ : state) {
+        for (int tick = 0; tick < TicksPerSecond; ++tick) {
+            for (int index = 0; index < PacketsPerTick; ++index) {
+                bool notify = false;
+                if (ring.push(packet.data(),
+                              static_cast<std::size_t>(packetLength(index)),
+                              &notify) && notify) {
+                    ++notifications;
+                    QMetaObject::invokeMethod(
+                        &sink,
+                        [&sink, &ring]() {
+                            ring.clearNotify();
+                            ring.drain([&sink](const char *data,
+                                               std::size_t length) {
+                                sink.write(data, static_cast<int>(length));
+                            });
+                        },
+                        Qt::QueuedConnection);
+                }
+            }
+            QCoreApplication::sendPostedEvents(&sink);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PacketsPerSecond);
+    state.SetBytesProcessed(static_cast<int64_t>(sink.bytes));
+    state.counters["notifications"] = static_cast<double>(notifications);
+    state.counters["dropped"] = static_cast<double>(ring.droppedPackets());
+}
+BENCHMARK(BM_RawLinkRing)->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+#include "BenchRawLink.moc"
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include "Plat/Private/QAutopilotTelemetryReducer.h"
+
+/**
+ * @brief 遥测归并热路径：位置 / 电池去重与移动状态判定
+ *
+ * 原 QAutopilot::positionUpdate / batteryUpdate / updateMovingState
+ * 的逻辑已移入 QAutopilotTelemetryReducer，这里直接测量 reducer，
+ * 每 8 个样本取出一次变化集合（相当于一次合并刷新）。
+ */
+namespace {
+
+constexpr int SamplesPerFlush = 8;
+
+void BM_ReducerPosition(benchmark::State &state)
+{
+    QAutopilotTelemetryReducer reducer;
+    quint64 sample = 0;
+    quint64 changed = 0;
+
+    for (auto _ : state) {
+        for (int index = 0; index < SamplesPerFlush; ++index, ++sample) {
+            reducer.position(116.0 + static_cast<double>(sample % 1000) * 1e-7,
+                             39.0, 50.0f, 10.0f);
+        }
+        const QAutopilotTelemetryChanges changes = reducer.takeChanges();
+        changed += changes.has(QAutopilotTelemetryChanges::GpsPosition);
+        benchmark::DoNotOptimize(changes);
+    }
+    state.SetItemsProcessed(state.iterations() * SamplesPerFlush);
+    state.counters["changed"] = static_cast<double>(changed);
+}
+BENCHMARK(BM_ReducerPosition);
+
+void BM_ReducerBattery(benchmark::State &state)
+{
+    QAutopilotTelemetryReducer reducer;
+    quint64 sample = 0;
+
+    for (auto _ : state) {
+        for (int index = 0; index < SamplesPerFlush; ++index, ++sample) {
+            /// 电压每 4 个样本变化一次，其余样本走去重路径
+            const float voltage =
+                16.2f - static_cast<float>((sample / 4) % 100) * 0.001f;
+            reducer.battery(0, 35.0f, voltage, 12.5f, 1.2f, 0.8f, 900.0f, 0);
+        }
+        benchmark::DoNotOptimize(reducer.takeChanges());
+    }
+    state.SetItemsProcessed(state.iterations() * SamplesPerFlush);
+}
+BENCHMARK(BM_ReducerBattery);
+
+void BM_ReducerMovingState(benchmark::State &state)
+{
+    QAutopilotMotionCounter motion;
+    QAutopilotTelemetryReducer reducer;
+    quint64 sample = 0;
+    quint64 transitions = 0;
+
+    for (auto _ : state) {
+        for (int index = 0; index < SamplesPerFlush; ++index, ++sample) {
+            /// 每 16 个样本在起动 / 停止阈值之间切换一次速度
+            const float speed = (sample / 16) % 2 == 0 ? 1.5f : 0.1f;
+            motion.sample(speed, 0.0f, 0.0f, false);
+            reducer.ned(static_cast<float>(sample % 100), 0.0f, -10.0f,
+                        speed, 0.0f, 0.0f);
+        }
+        reducer.motion(motion.load());
+        const QAutopilotTelemetryChanges changes = reducer.takeChanges();
+        transitions += changes.has(QAutopilotTelemetryChanges::Moving);
+        benchmark::DoNotOptimize(changes);
+    }
+    state.SetItemsProcessed(state.iterations() * SamplesPerFlush);
+    state.counters["transitions"] = static_cast<double>(transitions);
+}
+BENCHMARK(BM_ReducerMovingState);
+
+} // namespace
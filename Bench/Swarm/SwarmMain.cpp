@@ -0,0 +1,383 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QTimer>
+#include <QUdpSocket>
+#include <QVector>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "QGroundControlStation.h"
+#include "QGCSConfig.h"
+#include "Link/QDataLink.h"
+#include "Link/QLinkManager.h"
+#include "Plat/QAutopilot.h"
+#include "Plat/QPlat.h"
+#include "SwarmVehicle.h"
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * @brief 集群压测：N 架模拟飞机经 Raw 链路或本地 UDP 接入地面站
+ *
+ * 统计发现耗时、GLOBAL_POSITION_INT 发出到 gpsPositionChanged 的延迟、
+ * 航线下载耗时以及进程 CPU 与内存占用。
+ */
+namespace {
+
+constexpr int LatencySlots = 1024;
+
+struct ProcessUsage
+{
+    double cpuSeconds{0.0};
+    double peakRssMiB{0.0};
+};
+
+ProcessUsage sampleProcessUsage()
+{
+    ProcessUsage usage;
+#ifdef Q_OS_WIN
+    FILETIME creation, exitTime, kernel, user;
+    if (GetProcessTimes(GetCurrentProcess(), &creation, &exitTime, &kernel,
+                        &user)) {
+        const auto toSeconds = [](const FILETIME &time) {
+            ULARGE_INTEGER value;
+            value.LowPart = time.dwLowDateTime;
+            value.HighPart = time.dwHighDateTime;
+            return static_cast<double>(value.QuadPart) / 1e7;
+        };
+        usage.cpuSeconds = toSeconds(kernel) + toSeconds(user);
+    }
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                             sizeof(counters))) {
+        usage.peakRssMiB =
+            static_cast<double>(counters.PeakWorkingSetSize) / (1024 * 1024);
+    }
+#else
+    rusage self{};
+    if (getrusage(RUSAGE_SELF, &self) == 0) {
+        usage.cpuSeconds =
+            static_cast<double>(self.ru_utime.tv_sec + self.ru_stime.tv_sec) +
+            static_cast<double>(self.ru_utime.tv_usec + self.ru_stime.tv_usec) /
+                1e6;
+#ifdef Q_OS_MACOS
+        usage.peakRssMiB = static_cast<double>(self.ru_maxrss) / (1024 * 1024);
+#else
+        usage.peakRssMiB = static_cast<double>(self.ru_maxrss) / 1024;
+#endif
+    }
+#endif
+    return usage;
+}
+
+double percentile(std::vector<qint64> &samples, double fraction)
+{
+    if (samples.empty()) {
+        return 0.0;
+    }
+    const auto index = static_cast<std::size_t>(
+        fraction * static_cast<double>(samples.size() - 1));
+    std::nth_element(samples.begin(),
+                     samples.begin() + static_cast<std::ptrdiff_t>(index),
+                     samples.end());
+    return static_cast<double>(samples[index]) / 1e6;
+}
+
+/**
+ * @brief 单架飞机的收发端
+ */
+struct SwarmEndpoint
+{
+    std::unique_ptr<SwarmVehicle> vehicle;
+    std::unique_ptr<QUdpSocket> socket;   ///< 仅 UDP 模式
+    SwarmMavlink::Parser parser;          ///< 仅 UDP 模式
+    std::array<qint64, LatencySlots> sentAtNs{};
+    qint64 discoveredAtNs{-1};
+    bool missionDownloaded{false};
+};
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("MiniGCS swarm load harness"));
+    parser.addHelpOption();
+    const QCommandLineOption vehiclesOption(
+        QStringLiteral("vehicles"), QStringLiteral("Number of vehicles (1-250)."),
+        QStringLiteral("n"), QStringLiteral("10"));
+    const QCommandLineOption transportOption(
+        QStringLiteral("transport"), QStringLiteral("raw or udp."),
+        QStringLiteral("kind"), QStringLiteral("raw"));
+    const QCommandLineOption durationOption(
+        QStringLiteral("duration"), QStringLiteral("Run time in seconds."),
+        QStringLiteral("s"), QStringLiteral("10"));
+    const QCommandLineOption rateOption(
+        QStringLiteral("rate"),
+        QStringLiteral("ATTITUDE / GLOBAL_POSITION_INT rate in Hz."),
+        QStringLiteral("hz"), QStringLiteral("10"));
+    const QCommandLineOption missionOption(
+        QStringLiteral("mission"),
+        QStringLiteral("Mission items served per vehicle; 0 skips download."),
+        QStringLiteral("n"), QStringLiteral("8"));
+    const QCommandLineOption portOption(
+        QStringLiteral("udp-port"), QStringLiteral("Ground station UDP port."),
+        QStringLiteral("port"), QStringLiteral("14550"));
+    parser.addOptions({vehiclesOption, transportOption, durationOption,
+                       rateOption, missionOption, portOption});
+    parser.process(app);
+
+    const int vehicleCount =
+        std::clamp(parser.value(vehiclesOption).toInt(), 1, 250);
+    const bool useUdp =
+        parser.value(transportOption).compare(QStringLiteral("udp"),
+                                              Qt::CaseInsensitive) == 0;
+    const int durationS = std::max(1, parser.value(durationOption).toInt());
+    const int rateHz = std::clamp(parser.value(rateOption).toInt(), 1, 200);
+    const int missionItems = std::max(0, parser.value(missionOption).toInt());
+    const auto udpPort = static_cast<quint16>(parser.value(portOption).toUInt());
+
+    QGroundControlStation station;
+    station.Init();
+
+    QElapsedTimer clock;
+    clock.start();
+
+    /// 系统 ID 从 1 开始分配，跳过地面站自身的 ID
+    const uint8_t stationId = QGCSConfig::instance()->stationId();
+    std::array<std::unique_ptr<SwarmEndpoint>, 256> endpoints;
+    QVector<uint8_t> systemIds;
+    for (int id = 1; id < 256 && systemIds.size() < vehicleCount; ++id) {
+        if (id == stationId) {
+            continue;
+        }
+        auto endpoint = std::make_unique<SwarmEndpoint>();
+        endpoint->vehicle = std::make_unique<SwarmVehicle>(
+            static_cast<uint8_t>(id), missionItems);
+        endpoint->sentAtNs.fill(-1);
+        endpoints[id] = std::move(endpoint);
+        systemIds.append(static_cast<uint8_t>(id));
+    }
+
+    std::function<void(SwarmEndpoint &, const std::vector<std::uint8_t> &)> send;
+    QDataLink *rawLink = nullptr;
+    SwarmMavlink::Parser rawParser;
+    std::vector<std::uint8_t> reply;
+
+    if (useUdp) {
+        LinkParams params;
+        params.port = udpPort;
+        station.linkManager()->addLink(LinkKind::UdpServer, params);
+        for (const uint8_t id : std::as_const(systemIds)) {
+            SwarmEndpoint *endpoint = endpoints[id].get();
+            endpoint->socket = std::make_unique<QUdpSocket>();
+            endpoint->socket->bind(QHostAddress::LocalHost, 0);
+            QObject::connect(
+                endpoint->socket.get(), &QUdpSocket::readyRead,
+                [endpoint, &reply, udpPort]() {
+                    while (endpoint->socket->hasPendingDatagrams()) {
+                        const qint64 size =
+                            endpoint->socket->pendingDatagramSize();
+                        std::vector<std::uint8_t> datagram(
+                            static_cast<std::size_t>(std::max<qint64>(size, 0)));
+                        endpoint->socket->readDatagram(
+                            reinterpret_cast<char *>(datagram.data()), size);
+                        reply.clear();
+                        endpoint->parser.feed(
+                            datagram.data(), datagram.size(),
+                            [endpoint, &reply](const SwarmMavlink::Frame &frame) {
+                                endpoint->vehicle->handle(frame, reply);
+                            });
+                        if (!reply.empty()) {
+                            endpoint->socket->writeDatagram(
+                                reinterpret_cast<const char *>(reply.data()),
+                                static_cast<qint64>(reply.size()),
+                                QHostAddress::LocalHost, udpPort);
+                        }
+                    }
+                });
+        }
+        send = [udpPort](SwarmEndpoint &endpoint,
+                         const std::vector<std::uint8_t> &bytes) {
+            endpoint.socket->writeDatagram(
+                reinterpret_cast<const char *>(bytes.data()),
+                static_cast<qint64>(bytes.size()), QHostAddress::LocalHost,
+                udpPort);
+        };
+    } else {
+        /// Raw 链路模拟一条多机共享的数传电台：地面站发出的帧分发给所有飞机
+        rawLink = station.linkManager()->addLink(LinkKind::Raw, LinkParams{});
+        if (!rawLink) {
+            std::fprintf(stderr, "failed to create raw link\n");
+            return 1;
+        }
+        QObject::connect(
+            rawLink, &QDataLink::rawDataReady,
+            [rawLink, &rawParser, &reply, &endpoints, &systemIds]() {
+                reply.clear();
+                rawLink->drainRawPackets([&](const char *data, int length) {
+                    rawParser.feed(
+                        reinterpret_cast<const std::uint8_t *>(data),
+                        static_cast<std::size_t>(length),
+                        [&](const SwarmMavlink::Frame &frame) {
+                            for (const uint8_t id : std::as_const(systemIds)) {
+                                endpoints[id]->vehicle->handle(frame, reply);
+                            }
+                        });
+                });
+                if (!reply.empty()) {
+                    rawLink->sendRawData(
+                        reinterpret_cast<const char *>(reply.data()),
+                        static_cast<int>(reply.size()));
+                }
+            });
+        send = [rawLink](SwarmEndpoint &,
+                         const std::vector<std::uint8_t> &bytes) {
+            rawLink->sendRawData(reinterpret_cast<const char *>(bytes.data()),
+                                 static_cast<int>(bytes.size()));
+        };
+    }
+
+    int discovered = 0;
+    qint64 lastDiscoveryNs = 0;
+    int missionsDone = 0;
+    int missionsFailed = 0;
+    qint64 missionStartNs = -1;
+    qint64 missionEndNs = -1;
+    quint64 positionsSent = 0;
+    std::vector<qint64> latencies;
+    QVector<QAutopilot *> autopilots;
+
+    const auto startMissionDownloads = [&]() {
+        if (missionItems == 0 || missionStartNs >= 0) {
+            return;
+        }
+        missionStartNs = clock.nsecsElapsed();
+        for (QAutopilot *autopilot : std::as_const(autopilots)) {
+            autopilot->downloadAirLine();
+        }
+    };
+    const auto finishMission = [&]() {
+        if (missionsDone + missionsFailed == autopilots.size()) {
+            missionEndNs = clock.nsecsElapsed();
+        }
+    };
+
+    QObject::connect(&station, &QGroundControlStation::newPlatFind,
+                     [&](QPlat *plat) {
+        const int id = plat ? plat->systemId() : 0;
+        if (id <= 0 || id > 255 || !endpoints[id] ||
+            endpoints[id]->discoveredAtNs >= 0) {
+            return;
+        }
+        SwarmEndpoint *endpoint = endpoints[id].get();
+        endpoint->discoveredAtNs = clock.nsecsElapsed();
+        lastDiscoveryNs = endpoint->discoveredAtNs;
+        ++discovered;
+
+        if (auto *autopilot = qobject_cast<QAutopilot *>(plat)) {
+            autopilots.append(autopilot);
+            QObject::connect(
+                autopilot, &QAutopilot::gpsPositionChanged,
+                [&, endpoint, id](const QGpsPosition &position) {
+                    const std::uint32_t sample =
+                        SwarmVehicle::sampleFromLatitude(
+                            static_cast<uint8_t>(id), position.latitude());
+                    qint64 &sentAt = endpoint->sentAtNs[sample % LatencySlots];
+                    if (sentAt >= 0) {
+                        latencies.push_back(clock.nsecsElapsed() - sentAt);
+                        sentAt = -1;
+                    }
+                });
+            QObject::connect(autopilot, &QAutopilot::missionDownloaded,
+                             [&, endpoint](const QList<QMissionPoint> &) {
+                if (!endpoint->missionDownloaded) {
+                    endpoint->missionDownloaded = true;
+                    ++missionsDone;
+                    finishMission();
+                }
+            });
+            QObject::connect(autopilot, &QAutopilot::airLineDownloadFailed,
+                             [&](const QString &) {
+                ++missionsFailed;
+                finishMission();
+            });
+        }
+        if (discovered == systemIds.size()) {
+            startMissionDownloads();
+        }
+    });
+
+    std::vector<std::uint8_t> outgoing;
+    quint64 tick = 0;
+    QTimer telemetryTimer;
+    telemetryTimer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&telemetryTimer, &QTimer::timeout, [&]() {
+        const auto timeMs = static_cast<std::uint32_t>(clock.elapsed());
+        const bool slowTick = tick % static_cast<quint64>(rateHz) == 0;
+        for (const uint8_t id : std::as_const(systemIds)) {
+            SwarmEndpoint &endpoint = *endpoints[id];
+            outgoing.clear();
+            if (slowTick) {
+                endpoint.vehicle->appendHeartbeat(outgoing);
+                endpoint.vehicle->appendSysStatus(outgoing);
+            }
+            endpoint.vehicle->appendAttitude(outgoing, timeMs);
+            const std::uint32_t sample =
+                endpoint.vehicle->appendPosition(outgoing, timeMs);
+            endpoint.sentAtNs[sample % LatencySlots] = clock.nsecsElapsed();
+            send(endpoint, outgoing);
+            ++positionsSent;
+        }
+        ++tick;
+    });
+    telemetryTimer.start(1000 / rateHz);
+
+    QTimer::singleShot(durationS * 1000, &app, &QCoreApplication::quit);
+    const ProcessUsage startUsage = sampleProcessUsage();
+    app.exec();
+    telemetryTimer.stop();
+
+    const ProcessUsage endUsage = sampleProcessUsage();
+    const double wallS = static_cast<double>(clock.nsecsElapsed()) / 1e9;
+    const double cpuS = endUsage.cpuSeconds - startUsage.cpuSeconds;
+
+    std::printf("transport            %s\n", useUdp ? "udp" : "raw");
+    std::printf("vehicles             %d (discovered %d)\n",
+                static_cast<int>(systemIds.size()), discovered);
+    std::printf("discovery_ms         %.1f\n",
+                static_cast<double>(lastDiscoveryNs) / 1e6);
+    std::printf("positions_sent       %llu\n",
+                static_cast<unsigned long long>(positionsSent));
+    std::printf("positions_delivered  %zu\n", latencies.size());
+    std::printf("latency_ms p50/p95/p99/max  %.2f / %.2f / %.2f / %.2f\n",
+                percentile(latencies, 0.50), percentile(latencies, 0.95),
+                percentile(latencies, 0.99), percentile(latencies, 1.0));
+    if (missionItems > 0) {
+        std::printf("mission_download     %d ok, %d failed, %.1f ms\n",
+                    missionsDone, missionsFailed,
+                    missionStartNs >= 0 && missionEndNs >= 0
+                        ? static_cast<double>(missionEndNs - missionStartNs) / 1e6
+                        : -1.0);
+    }
+    std::printf("cpu_s                %.2f (%.1f%% of one core)\n", cpuS,
+                wallS > 0.0 ? 100.0 * cpuS / wallS : 0.0);
+    std::printf("peak_rss_mib         %.1f\n", endUsage.peakRssMiB);
+
+    station.ClearAllLinks();
+    return discovered == systemIds.size() ? 0 : 2;
+}
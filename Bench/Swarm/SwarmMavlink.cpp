@@ -0,0 +1,120 @@
+#include "SwarmMavlink.h"
+#include <algorithm>
+
+namespace SwarmMavlink {
+
+namespace {
+
+constexpr std::uint8_t MagicV1 = 0xFE;
+constexpr std::uint8_t MagicV2 = 0xFD;
+constexpr std::uint8_t IncompatSigned = 0x01;
+constexpr std::size_t SignatureLength = 13;
+
+std::uint8_t crcExtra(std::uint32_t msgId)
+{
+    switch (msgId) {
+    case Heartbeat: return 50;
+    case SysStatus: return 124;
+    case Attitude: return 39;
+    case GlobalPositionInt: return 104;
+    case MissionRequestList: return 132;
+    case MissionCount: return 221;
+    case MissionClearAll: return 232;
+    case MissionAck: return 153;
+    case MissionRequestInt: return 196;
+    case MissionItemInt: return 38;
+    default: return 0;
+    }
+}
+
+void crcAccumulate(std::uint16_t &crc, std::uint8_t byte)
+{
+    std::uint8_t tmp = byte ^ static_cast<std::uint8_t>(crc & 0xFF);
+    tmp ^= static_cast<std::uint8_t>(tmp << 4);
+    crc = static_cast<std::uint16_t>((crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^
+                                     (tmp >> 4));
+}
+
+} // namespace
+
+void appendFrame(std::vector<std::uint8_t> &out, std::uint8_t &sequence,
+                 std::uint8_t sysId, std::uint8_t compId,
+                 std::uint32_t msgId, const Payload &payload)
+{
+    std::size_t length = payload.length();
+    while (length > 1 && payload.data()[length - 1] == 0) {
+        --length;
+    }
+
+    const std::size_t start = out.size();
+    out.push_back(MagicV2);
+    out.push_back(static_cast<std::uint8_t>(length));
+    out.push_back(0);
+    out.push_back(0);
+    out.push_back(sequence++);
+    out.push_back(sysId);
+    out.push_back(compId);
+    out.push_back(static_cast<std::uint8_t>(msgId & 0xFF));
+    out.push_back(static_cast<std::uint8_t>((msgId >> 8) & 0xFF));
+    out.push_back(static_cast<std::uint8_t>((msgId >> 16) & 0xFF));
+    out.insert(out.end(), payload.data(), payload.data() + length);
+
+    std::uint16_t crc = 0xFFFF;
+    for (std::size_t index = start + 1; index < out.size(); ++index) {
+        crcAccumulate(crc, out[index]);
+    }
+    crcAccumulate(crc, crcExtra(msgId));
+    out.push_back(static_cast<std::uint8_t>(crc & 0xFF));
+    out.push_back(static_cast<std::uint8_t>(crc >> 8));
+}
+
+void Parser::feed(const std::uint8_t *data, std::size_t length,
+                  const std::function<void(const Frame &)> &handler)
+{
+    m_buffer.insert(m_buffer.end(), data, data + length);
+
+    std::size_t position = 0;
+    while (position < m_buffer.size()) {
+        const std::uint8_t magic = m_buffer[position];
+        if (magic != MagicV1 && magic != MagicV2) {
+            ++position;
+            continue;
+        }
+        const std::size_t headerLength = magic == MagicV2 ? 10 : 6;
+        if (m_buffer.size() - position < headerLength) {
+            break;
+        }
+        const std::uint8_t *header = m_buffer.data() + position;
+        const std::size_t payloadLength = header[1];
+        std::size_t frameLength = headerLength + payloadLength + 2;
+        if (magic == MagicV2 && (header[2] & IncompatSigned) != 0) {
+            frameLength += SignatureLength;
+        }
+        if (m_buffer.size() - position < frameLength) {
+            break;
+        }
+
+        Frame frame;
+        frame.length = payloadLength;
+        if (magic == MagicV2) {
+            frame.sysId = header[5];
+            frame.compId = header[6];
+            frame.msgId = header[7] | (header[8] << 8) |
+                          (static_cast<std::uint32_t>(header[9]) << 16);
+        } else {
+            frame.sysId = header[3];
+            frame.compId = header[4];
+            frame.msgId = header[5];
+        }
+        std::memcpy(frame.payload, header + headerLength, payloadLength);
+        if (handler) {
+            handler(frame);
+        }
+        position += frameLength;
+    }
+    m_buffer.erase(m_buffer.begin(),
+                   m_buffer.begin() + static_cast<std::ptrdiff_t>(
+                       std::min(position, m_buffer.size())));
+}
+
+} // namespace SwarmMavlink
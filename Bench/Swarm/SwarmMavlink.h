@@ -0,0 +1,100 @@
+#ifndef SWARMMAVLINK_H
+#define SWARMMAVLINK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief 压测用的最小 MAVLink v2 编解码
+ *
+ * 只覆盖模拟飞机需要的消息，不依赖 MAVSDK 内部的 mavlink 头文件。
+ * 载荷按小端字节序读写；本地回环链路不校验接收帧的 CRC。
+ */
+namespace SwarmMavlink {
+
+enum MessageId : std::uint32_t {
+    Heartbeat = 0,
+    SysStatus = 1,
+    Attitude = 30,
+    GlobalPositionInt = 33,
+    MissionRequestList = 43,
+    MissionCount = 44,
+    MissionClearAll = 45,
+    MissionAck = 47,
+    MissionRequestInt = 51,
+    MissionItemInt = 73
+};
+
+/// 单帧最大长度：头 10 + 载荷 255 + CRC 2 + 签名 13
+constexpr std::size_t MaxFrameLength = 280;
+
+/**
+ * @brief 解出的一帧；载荷已按截断规则补零，可按完整长度读取
+ */
+struct Frame
+{
+    std::uint32_t msgId{0};
+    std::uint8_t sysId{0};
+    std::uint8_t compId{0};
+    std::uint8_t payload[255]{};
+    std::size_t length{0};
+
+    template<typename T>
+    T read(std::size_t offset) const
+    {
+        T value{};
+        std::memcpy(&value, payload + offset, sizeof(T));
+        return value;
+    }
+};
+
+/**
+ * @brief 载荷写入缓冲
+ */
+class Payload
+{
+public:
+    template<typename T>
+    Payload &put(std::size_t offset, T value)
+    {
+        std::memcpy(m_data + offset, &value, sizeof(T));
+        if (offset + sizeof(T) > m_length) {
+            m_length = offset + sizeof(T);
+        }
+        return *this;
+    }
+
+    const std::uint8_t *data() const { return m_data; }
+    std::size_t length() const { return m_length; }
+
+private:
+    std::uint8_t m_data[255]{};
+    std::size_t m_length{0};
+};
+
+/**
+ * @brief 编码一帧 MAVLink v2 并追加到 out（末尾零字节按规范截断）
+ */
+void appendFrame(std::vector<std::uint8_t> &out, std::uint8_t &sequence,
+                 std::uint8_t sysId, std::uint8_t compId,
+                 std::uint32_t msgId, const Payload &payload);
+
+/**
+ * @brief 字节流解帧（支持 v1/v2，跨调用拼接不完整帧）
+ */
+class Parser
+{
+public:
+    void feed(const std::uint8_t *data, std::size_t length,
+              const std::function<void(const Frame &)> &handler);
+
+private:
+    std::vector<std::uint8_t> m_buffer;
+};
+
+} // namespace SwarmMavlink
+
+#endif // SWARMMAVLINK_H
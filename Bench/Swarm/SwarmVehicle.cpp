@@ -0,0 +1,237 @@
+#include "SwarmVehicle.h"
+#include <cmath>
+
+using SwarmMavlink::Payload;
+
+namespace {
+
+constexpr std::uint8_t ComponentAutopilot = 1;
+constexpr std::uint8_t MavTypeQuadrotor = 2;
+constexpr std::uint8_t MavAutopilotPx4 = 12;
+constexpr std::uint8_t MavModeFlagCustomModeEnabled = 1;
+constexpr std::uint8_t MavStateActive = 4;
+constexpr std::uint8_t MavFrameGlobalRelativeAltInt = 6;
+constexpr std::uint16_t MavCmdNavWaypoint = 16;
+constexpr std::uint8_t MavMissionAccepted = 0;
+constexpr std::uint8_t MavMissionTypeMission = 0;
+constexpr std::int32_t LongitudeE7 = 1200000000;
+
+} // namespace
+
+SwarmVehicle::SwarmVehicle(std::uint8_t systemId, int missionItemCount)
+    : m_systemId(systemId)
+{
+    const std::int32_t latitude = baseLatitudeE7(systemId);
+    for (int index = 0; index < missionItemCount; ++index) {
+        m_mission.push_back(MissionItem{latitude + index * 1000,
+                                        LongitudeE7 + index * 1000,
+                                        50.0f});
+    }
+}
+
+std::int32_t SwarmVehicle::baseLatitudeE7(std::uint8_t systemId)
+{
+    /// 每架飞机相隔 0.1°，样本序号占用纬度的低位
+    return 300000000 + static_cast<std::int32_t>(systemId) * 1000000;
+}
+
+std::uint32_t SwarmVehicle::sampleFromLatitude(std::uint8_t systemId,
+                                               double latitudeDeg)
+{
+    const auto latitudeE7 =
+        static_cast<std::int64_t>(std::llround(latitudeDeg * 1e7));
+    return static_cast<std::uint32_t>(latitudeE7 - baseLatitudeE7(systemId)) %
+           SampleModulo;
+}
+
+void SwarmVehicle::appendHeartbeat(std::vector<std::uint8_t> &out)
+{
+    Payload payload;
+    payload.put<std::uint32_t>(0, 0)
+        .put<std::uint8_t>(4, MavTypeQuadrotor)
+        .put<std::uint8_t>(5, MavAutopilotPx4)
+        .put<std::uint8_t>(6, MavModeFlagCustomModeEnabled)
+        .put<std::uint8_t>(7, MavStateActive)
+        .put<std::uint8_t>(8, 3);
+    SwarmMavlink::appendFrame(out, m_sequence, m_systemId, ComponentAutopilot,
+                              SwarmMavlink::Heartbeat, payload);
+}
+
+void SwarmVehicle::appendSysStatus(std::vector<std::uint8_t> &out)
+{
+    Payload payload;
+    payload.put<std::uint16_t>(12, 250)
+        .put<std::uint16_t>(14, 16200)
+        .put<std::int16_t>(16, 1200)
+        .put<std::int8_t>(30, 80);
+    SwarmMavlink::appendFrame(out, m_sequence, m_systemId, ComponentAutopilot,
+                              SwarmMavlink::SysStatus, payload);
+}
+
+void SwarmVehicle::appendAttitude(std::vector<std::uint8_t> &out,
+                                  std::uint32_t timeMs)
+{
+    const float phase = static_cast<float>(timeMs % 10000) / 10000.0f;
+    Payload payload;
+    payload.put<std::uint32_t>(0, timeMs)
+        .put<float>(4, 0.05f * phase)
+        .put<float>(8, -0.05f * phase)
+        .put<float>(12, 6.2831853f * phase);
+    SwarmMavlink::appendFrame(out, m_sequence, m_systemId, ComponentAutopilot,
+                              SwarmMavlink::Attitude, payload);
+}
+
+std::uint32_t SwarmVehicle::appendPosition(std::vector<std::uint8_t> &out,
+                                           std::uint32_t timeMs)
+{
+    const std::uint32_t sample = m_sample;
+    m_sample = (m_sample + 1) % SampleModulo;
+
+    Payload payload;
+    payload.put<std::uint32_t>(0, timeMs)
+        .put<std::int32_t>(4, baseLatitudeE7(m_systemId) +
+                                  static_cast<std::int32_t>(sample))
+        .put<std::int32_t>(8, LongitudeE7)
+        .put<std::int32_t>(12, 100000)
+        .put<std::int32_t>(16, 50000)
+        .put<std::int16_t>(20, 500)
+        .put<std::uint16_t>(26, 9000);
+    SwarmMavlink::appendFrame(out, m_sequence, m_systemId, ComponentAutopilot,
+                              SwarmMavlink::GlobalPositionInt, payload);
+    return sample;
+}
+
+void SwarmVehicle::handle(const SwarmMavlink::Frame &frame,
+                          std::vector<std::uint8_t> &out)
+{
+    switch (frame.msgId) {
+    case SwarmMavlink::MissionRequestList: {
+        if (frame.read<std::uint8_t>(0) != m_systemId) {
+            return;
+        }
+        const auto missionType = frame.read<std::uint8_t>(2);
+        const auto count = missionType == MavMissionTypeMission
+            ? static_cast<std::uint16_t>(m_mission.size())
+            : std::uint16_t{0};
+        Payload payload;
+        payload.put<std::uint16_t>(0, count)
+            .put<std::uint8_t>(2, frame.sysId)
+            .put<std::uint8_t>(3, frame.compId)
+            .put<std::uint8_t>(4, missionType);
+        SwarmMavlink::appendFrame(out, m_sequence, m_systemId,
+                                  ComponentAutopilot,
+                                  SwarmMavlink::MissionCount, payload);
+        break;
+    }
+    case SwarmMavlink::MissionRequestInt: {
+        if (frame.read<std::uint8_t>(2) != m_systemId) {
+            return;
+        }
+        appendMissionItem(out, frame.read<std::uint16_t>(0), frame.sysId,
+                          frame.compId);
+        break;
+    }
+    case SwarmMavlink::MissionCount: {
+        if (frame.read<std::uint8_t>(2) != m_systemId) {
+            return;
+        }
+        m_uploadExpected = frame.read<std::uint16_t>(0);
+        m_uploadReceived = 0;
+        m_upload.clear();
+        if (m_uploadExpected == 0) {
+            appendMissionAck(out, frame.sysId, frame.compId,
+                             frame.read<std::uint8_t>(4));
+        } else {
+            appendMissionRequest(out, 0, frame.sysId, frame.compId);
+        }
+        break;
+    }
+    case SwarmMavlink::MissionItemInt: {
+        if (frame.read<std::uint8_t>(32) != m_systemId) {
+            return;
+        }
+        const auto seq = frame.read<std::uint16_t>(28);
+        if (seq != m_uploadReceived || m_uploadReceived >= m_uploadExpected) {
+            return;
+        }
+        m_upload.push_back(MissionItem{frame.read<std::int32_t>(16),
+                                       frame.read<std::int32_t>(20),
+                                       frame.read<float>(24)});
+        ++m_uploadReceived;
+        if (m_uploadReceived < m_uploadExpected) {
+            appendMissionRequest(out,
+                                 static_cast<std::uint16_t>(m_uploadReceived),
+                                 frame.sysId, frame.compId);
+        } else {
+            m_mission.swap(m_upload);
+            appendMissionAck(out, frame.sysId, frame.compId,
+                             frame.read<std::uint8_t>(37));
+        }
+        break;
+    }
+    case SwarmMavlink::MissionClearAll: {
+        if (frame.read<std::uint8_t>(0) != m_systemId) {
+            return;
+        }
+        m_mission.clear();
+        appendMissionAck(out, frame.sysId, frame.compId,
+                         frame.read<std::uint8_t>(2));
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void SwarmVehicle::appendMissionItem(std::vector<std::uint8_t> &out,
+                                     std::uint16_t seq,
+                                     std::uint8_t targetSystem,
+                                     std::uint8_t targetComponent)
+{
+    if (seq >= m_mission.size()) {
+        return;
+    }
+    const MissionItem &item = m_mission[seq];
+    Payload payload;
+    payload.put<std::int32_t>(16, item.latitudeE7)
+        .put<std::int32_t>(20, item.longitudeE7)
+        .put<float>(24, item.altitudeM)
+        .put<std::uint16_t>(28, seq)
+        .put<std::uint16_t>(30, MavCmdNavWaypoint)
+        .put<std::uint8_t>(32, targetSystem)
+        .put<std::uint8_t>(33, targetComponent)
+        .put<std::uint8_t>(34, MavFrameGlobalRelativeAltInt)
+        .put<std::uint8_t>(35, seq == 0 ? 1 : 0)
+        .put<std::uint8_t>(36, 1)
+        .put<std::uint8_t>(37, MavMissionTypeMission);
+    SwarmMavlink::appendFrame(out, m_sequence, m_systemId, ComponentAutopilot,
+                              SwarmMavlink::MissionItemInt, payload);
+}
+
+void SwarmVehicle::appendMissionAck(std::vector<std::uint8_t> &out,
+                                    std::uint8_t targetSystem,
+                                    std::uint8_t targetComponent,
+                                    std::uint8_t missionType)
+{
+    Payload payload;
+    payload.put<std::uint8_t>(0, targetSystem)
+        .put<std::uint8_t>(1, targetComponent)
+        .put<std::uint8_t>(2, MavMissionAccepted)
+        .put<std::uint8_t>(3, missionType);
+    SwarmMavlink::appendFrame(out, m_sequence, m_systemId, ComponentAutopilot,
+                              SwarmMavlink::MissionAck, payload);
+}
+
+void SwarmVehicle::appendMissionRequest(std::vector<std::uint8_t> &out,
+                                        std::uint16_t seq,
+                                        std::uint8_t targetSystem,
+                                        std::uint8_t targetComponent)
+{
+    Payload payload;
+    payload.put<std::uint16_t>(0, seq)
+        .put<std::uint8_t>(2, targetSystem)
+        .put<std::uint8_t>(3, targetComponent)
+        .put<std::uint8_t>(4, MavMissionTypeMission);
+    SwarmMavlink::appendFrame(out, m_sequence, m_systemId, ComponentAutopilot,
+                              SwarmMavlink::MissionRequestInt, payload);
+}
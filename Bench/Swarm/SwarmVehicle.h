@@ -0,0 +1,77 @@
+#ifndef SWARMVEHICLE_H
+#define SWARMVEHICLE_H
+
+#include <cstdint>
+#include <vector>
+#include "SwarmMavlink.h"
+
+/**
+ * @brief 模拟飞机（PX4 多旋翼，组件 ID 1）
+ *
+ * 按调用方节拍生成 HEARTBEAT、SYS_STATUS、ATTITUDE、GLOBAL_POSITION_INT，
+ * 并应答航线上传/下载协议。生成的帧追加到调用方提供的缓冲区，
+ * 由调用方决定经 Raw 链路还是 UDP 发出。
+ */
+class SwarmVehicle
+{
+public:
+    SwarmVehicle(std::uint8_t systemId, int missionItemCount);
+
+    std::uint8_t systemId() const { return m_systemId; }
+
+    void appendHeartbeat(std::vector<std::uint8_t> &out);
+    void appendSysStatus(std::vector<std::uint8_t> &out);
+    void appendAttitude(std::vector<std::uint8_t> &out, std::uint32_t timeMs);
+
+    /**
+     * @brief 生成一条位置
+     * @return 样本序号，编码在纬度中，可由 sampleFromLatitude() 还原
+     */
+    std::uint32_t appendPosition(std::vector<std::uint8_t> &out,
+                                 std::uint32_t timeMs);
+
+    /**
+     * @brief 处理地面站发来的帧，应答写入 out
+     */
+    void handle(const SwarmMavlink::Frame &frame,
+                std::vector<std::uint8_t> &out);
+
+    int uploadedItemCount() const { return m_uploadReceived; }
+
+    /** 纬度编码的样本序号范围 */
+    static constexpr std::uint32_t SampleModulo = 1u << 20;
+    static std::uint32_t sampleFromLatitude(std::uint8_t systemId,
+                                            double latitudeDeg);
+
+private:
+    struct MissionItem
+    {
+        std::int32_t latitudeE7{0};
+        std::int32_t longitudeE7{0};
+        float altitudeM{0.0f};
+    };
+
+    static std::int32_t baseLatitudeE7(std::uint8_t systemId);
+    void appendMissionItem(std::vector<std::uint8_t> &out, std::uint16_t seq,
+                           std::uint8_t targetSystem,
+                           std::uint8_t targetComponent);
+    void appendMissionAck(std::vector<std::uint8_t> &out,
+                          std::uint8_t targetSystem,
+                          std::uint8_t targetComponent,
+                          std::uint8_t missionType);
+    void appendMissionRequest(std::vector<std::uint8_t> &out,
+                              std::uint16_t seq, std::uint8_t targetSystem,
+                              std::uint8_t targetComponent);
+
+    std::uint8_t m_systemId;
+    std::uint8_t m_sequence{0};
+    std::uint32_t m_sample{0};
+    std::vector<MissionItem> m_mission;
+
+    /// 上传中的航线
+    std::vector<MissionItem> m_upload;
+    int m_uploadExpected{0};
+    int m_uploadReceived{0};
+};
+
+#endif // SWARMVEHICLE_H
@@ -0,0 +1,16 @@
+#include <QCoreApplication>
+#include <benchmark/benchmark.h>
+
+int main(int argc, char *argv[])
+{
+    /// 排队投递与事件派发需要事件循环所在的应用对象
+    QCoreApplication app(argc, argv);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
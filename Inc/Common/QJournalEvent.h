@@ -0,0 +1,90 @@
+#ifndef _YTY_QJOURNALEVENT_H
+#define _YTY_QJOURNALEVENT_H
+
+#include <QObject>
+#include <QMetaType>
+#include "MiniGCSExport.h"
+
+/**
+ * @brief 二进制事件日志中的一条记录
+ *
+ * 由 QEventJournal::read() 返回。记录只含数值载荷，code 与 value 的含义
+ * 随事件类型而定，见 Type 各项说明；链路事件的 systemId 为链路指定的系统 ID，
+ * 未指定时为 0。
+ */
+class MINIGCS_EXPORT QJournalEvent
+{
+    Q_GADGET
+    Q_PROPERTY(quint64 sequence READ sequence WRITE setSequence)
+    Q_PROPERTY(qint64 timestampMs READ timestampMs WRITE setTimestampMs)
+    Q_PROPERTY(int systemId READ systemId WRITE setSystemId)
+    Q_PROPERTY(int componentId READ componentId WRITE setComponentId)
+    Q_PROPERTY(Type type READ type WRITE setType)
+    Q_PROPERTY(int code READ code WRITE setCode)
+    Q_PROPERTY(qint64 value READ value WRITE setValue)
+
+public:
+    /**
+     * @brief 事件类型；数值写入文件，只能追加
+     */
+    enum Type {
+        Unknown = 0,
+        /// 命令结果，code: MAV_CMD；value: 发出到得到结果的耗时（µs），未计时为 -1
+        CommandAccepted = 1,
+        CommandRejected = 2,
+        CommandTimedOut = 3,
+        CommandFailed = 4,     ///< 未能发出
+        FlightModeChanged = 5, ///< code: QAutopilot::FlightMode
+        ArmedChanged = 6,      ///< code: 1 解锁，0 上锁
+        ConnectionChanged = 7, ///< code: 1 连接，0 断开
+        StatusText = 8,        ///< componentId: 来源组件；code: MAV_SEVERITY
+        FirmwareVersion = 9,   ///< code: 飞控版本 major<<16|minor<<8|patch；value: 同格式的 OS 版本
+        InfoRequestFailed = 10, ///< code: 0 版本，1 产品信息；value: mavsdk::Info::Result
+        TelemetryRateFailed = 11, ///< code: 遥测频率位（0 为 in_air）；value: mavsdk::Telemetry::Result
+        LinkError = 12,        ///< code: QDataLink::LinkKind
+        LinkReconnected = 13,  ///< code: QDataLink::LinkKind；value: 重连次数
+        LinkReconnectFailed = 14 ///< code: QDataLink::LinkKind；value: 重连次数
+    };
+    Q_ENUM(Type)
+
+    QJournalEvent() = default;
+
+    /** 写入序号，从 1 递增；环形文件覆盖后仍保持递增 */
+    quint64 sequence() const { return m_sequence; }
+    void setSequence(quint64 sequence);
+
+    /** 自纪元起毫秒 */
+    qint64 timestampMs() const { return m_timestampMs; }
+    void setTimestampMs(qint64 timestampMs);
+
+    int systemId() const { return m_systemId; }
+    void setSystemId(int systemId);
+
+    int componentId() const { return m_componentId; }
+    void setComponentId(int componentId);
+
+    Type type() const { return m_type; }
+    void setType(Type type);
+
+    int code() const { return m_code; }
+    void setCode(int code);
+
+    qint64 value() const { return m_value; }
+    void setValue(qint64 value);
+
+    bool operator==(const QJournalEvent &other) const;
+    bool operator!=(const QJournalEvent &other) const;
+
+private:
+    quint64 m_sequence{0};
+    qint64 m_timestampMs{0};
+    int m_systemId{0};
+    int m_componentId{0};
+    Type m_type{Unknown};
+    int m_code{0};
+    qint64 m_value{0};
+};
+
+Q_DECLARE_METATYPE(QJournalEvent)
+
+#endif // _YTY_QJOURNALEVENT_H
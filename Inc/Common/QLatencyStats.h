@@ -0,0 +1,70 @@
+#ifndef _YTY_QLATENCYSTATS_H
+#define _YTY_QLATENCYSTATS_H
+
+#include <QObject>
+#include <QString>
+#include <QMetaType>
+#include "MiniGCSExport.h"
+
+/**
+ * @brief 一组延迟样本的统计摘要（毫秒）
+ *
+ * 分位数来自对数分桶直方图，相对误差不超过 1/16。
+ */
+class MINIGCS_EXPORT QLatencyStats
+{
+    Q_GADGET
+    Q_PROPERTY(QString name READ name WRITE setName)
+    Q_PROPERTY(quint64 count READ count WRITE setCount)
+    Q_PROPERTY(double minMs READ minMs WRITE setMinMs)
+    Q_PROPERTY(double meanMs READ meanMs WRITE setMeanMs)
+    Q_PROPERTY(double p50Ms READ p50Ms WRITE setP50Ms)
+    Q_PROPERTY(double p90Ms READ p90Ms WRITE setP90Ms)
+    Q_PROPERTY(double p99Ms READ p99Ms WRITE setP99Ms)
+    Q_PROPERTY(double maxMs READ maxMs WRITE setMaxMs)
+
+public:
+    QLatencyStats() = default;
+
+    /** 统计对象名称，如遥测流或命令名 */
+    QString name() const { return m_name; }
+    void setName(const QString &name);
+
+    quint64 count() const { return m_count; }
+    void setCount(quint64 count);
+
+    double minMs() const { return m_minMs; }
+    void setMinMs(double ms);
+
+    double meanMs() const { return m_meanMs; }
+    void setMeanMs(double ms);
+
+    double p50Ms() const { return m_p50Ms; }
+    void setP50Ms(double ms);
+
+    double p90Ms() const { return m_p90Ms; }
+    void setP90Ms(double ms);
+
+    double p99Ms() const { return m_p99Ms; }
+    void setP99Ms(double ms);
+
+    double maxMs() const { return m_maxMs; }
+    void setMaxMs(double ms);
+
+    bool operator==(const QLatencyStats &other) const;
+    bool operator!=(const QLatencyStats &other) const;
+
+private:
+    QString m_name;
+    quint64 m_count{0};
+    double m_minMs{0.0};
+    double m_meanMs{0.0};
+    double m_p50Ms{0.0};
+    double m_p90Ms{0.0};
+    double m_p99Ms{0.0};
+    double m_maxMs{0.0};
+};
+
+Q_DECLARE_METATYPE(QLatencyStats)
+
+#endif // _YTY_QLATENCYSTATS_H
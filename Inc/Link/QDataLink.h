@@ -4,10 +4,19 @@
 #include <QObject>
 #include <QString>
 #include <QByteArray>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QList>
 #include <QtGlobal>
+#include <functional>
+#include <memory>
 #include "Link/QLinkManager.h"
 #include "MiniGCSExport.h"
 
+class QRawPacketRing;
+class QLinkTrafficCounters;
+class QTimer;
+
 /**
  * @brief QDataLink - 单条数据链路
  *
@@ -22,6 +31,21 @@ class MINIGCS_EXPORT QDataLink : public QObject
     Q_PROPERTY(bool opened READ isOpened NOTIFY openStatusChanged)
     Q_PROPERTY(int reconnectAttempts READ reconnectAttempts NOTIFY reconnectAttemptsChanged)
     Q_PROPERTY(LinkKind linkKind READ linkKind CONSTANT)
+    Q_PROPERTY(int rawFlushThresholdBytes READ rawFlushThresholdBytes WRITE setRawFlushThresholdBytes NOTIFY rawFlushThresholdBytesChanged)
+    Q_PROPERTY(int rawFlushLatencyMs READ rawFlushLatencyMs WRITE setRawFlushLatencyMs NOTIFY rawFlushLatencyMsChanged)
+    Q_PROPERTY(int bandwidthBytesPerSecond READ bandwidthBytesPerSecond WRITE setBandwidthBytesPerSecond NOTIFY bandwidthBytesPerSecondChanged)
+    Q_PROPERTY(QList<int> assignedSystemIds READ assignedSystemIds WRITE setAssignedSystemIds NOTIFY assignedSystemIdsChanged)
+    Q_PROPERTY(int statsIntervalMs READ statsIntervalMs WRITE setStatsIntervalMs NOTIFY statsIntervalMsChanged)
+    Q_PROPERTY(quint64 bytesReceived READ bytesReceived NOTIFY trafficStatsChanged)
+    Q_PROPERTY(quint64 bytesSent READ bytesSent NOTIFY trafficStatsChanged)
+    Q_PROPERTY(quint64 packetsReceived READ packetsReceived NOTIFY trafficStatsChanged)
+    Q_PROPERTY(quint64 packetsSent READ packetsSent NOTIFY trafficStatsChanged)
+    Q_PROPERTY(double receivePacketsPerSecond READ receivePacketsPerSecond NOTIFY trafficStatsChanged)
+    Q_PROPERTY(double sendPacketsPerSecond READ sendPacketsPerSecond NOTIFY trafficStatsChanged)
+    Q_PROPERTY(quint64 packetsLost READ packetsLost NOTIFY trafficStatsChanged)
+    Q_PROPERTY(double lossPercent READ lossPercent NOTIFY trafficStatsChanged)
+    Q_PROPERTY(quint64 crcErrors READ crcErrors NOTIFY trafficStatsChanged)
+    Q_PROPERTY(QDateTime lastReceiveTime READ lastReceiveTime NOTIFY trafficStatsChanged)
 
 public:
     ~QDataLink();
@@ -43,24 +67,143 @@ public:
     bool sendRawData(const char *data, int length);
     Q_INVOKABLE bool sendRawData(const QByteArray &data);
 
+    /**
+     * @brief 批量取出待发送到物理链路的原始包（仅 Raw 高级模式）
+     * @param consumer 对每个包调用一次；数据指向内部环形缓冲区，仅在回调期间有效
+     * @param maxPackets 本次最多取出的包数，0 表示全部
+     * @return 取出的包数
+     */
+    int drainRawPackets(
+        const std::function<void(const char *data, int length)> &consumer,
+        int maxPackets = 0);
+
+    /**
+     * @brief 批量取出待发送字节并合并为连续帧（仅 Raw 高级模式）
+     * @param consumer 每帧调用一次；帧缓冲区复用，仅在回调期间有效
+     * @return 取出的字节数
+     * @note 单帧不超过 rawFlushThresholdBytes（为 0 时整批合并为一帧）
+     */
+    int drainRawData(
+        const std::function<void(const char *data, int length)> &consumer);
+
+    /**
+     * @brief 合并发送的大小阈值（字节，仅 Raw 高级模式）
+     *
+     * 待发送字节达到阈值时立即刷新，同时作为单帧上限；0 表示不限。
+     */
+    int rawFlushThresholdBytes() const { return m_rawFlushThresholdBytes; }
+    void setRawFlushThresholdBytes(int bytes);
+
+    /**
+     * @brief 合并发送的最长等待时间（毫秒，仅 Raw 高级模式）
+     *
+     * 0 表示每个事件循环轮次刷新一次；大于 0 时在首包到达后最多等待该时长，
+     * 期间到达的字节合并为一批。
+     */
+    int rawFlushLatencyMs() const { return m_rawFlushLatencyMs; }
+    void setRawFlushLatencyMs(int latencyMs);
+
+    /**
+     * @brief 链路标称带宽（字节/秒），用于遥测频率预算
+     *
+     * 串口链路默认取波特率 / 10（8N1），其他链路默认 0 表示不限；
+     * 数传电台空中速率低于串口波特率时应按实际空中速率设置。
+     */
+    int bandwidthBytesPerSecond() const { return m_bandwidthBytesPerSecond; }
+    void setBandwidthBytesPerSecond(int bytesPerSecond);
+
+    /**
+     * @brief 经该链路到达的系统 ID
+     *
+     * 为空时视为全部已连接飞机共享该链路（MAVSDK 不区分系统来自哪条连接）。
+     */
+    QList<int> assignedSystemIds() const { return m_assignedSystemIds; }
+    void setAssignedSystemIds(const QList<int> &systemIds);
+
+    /**
+     * @brief 流量统计周期（毫秒），默认 1000；0 表示停止周期刷新
+     *
+     * 每个周期计算一次收发包速率并在计数变化时发射 trafficStatsChanged()。
+     */
+    int statsIntervalMs() const { return m_statsIntervalMs; }
+    void setStatsIntervalMs(int intervalMs);
+
+    /**
+     * @brief 链路累计流量
+     *
+     * Raw 链路统计喂入的全部字节并自行分帧校验，可统计 CRC 错误；
+     * 由 MAVSDK 管理的链路按 MAVSDK 校验通过的消息统计（CRC 错误恒为 0），
+     * 按 assignedSystemIds 归属到链路；未指定时仅在它是唯一打开的链路时计数，
+     * 否则保持为 0。
+     */
+    quint64 bytesReceived() const;
+    quint64 bytesSent() const;
+    quint64 packetsReceived() const;
+    quint64 packetsSent() const;
+    /** 按 MAVLink 序号跳变估计的丢包数 */
+    quint64 packetsLost() const;
+    /** 丢包占应收包的百分比 */
+    double lossPercent() const;
+    quint64 crcErrors() const;
+    /** 最近一个统计周期的收发包速率 */
+    double receivePacketsPerSecond() const { return m_receivePacketsPerSecond; }
+    double sendPacketsPerSecond() const { return m_sendPacketsPerSecond; }
+    /** 最近一次收到数据的时间，尚未收到时无效 */
+    QDateTime lastReceiveTime() const;
+
+    Q_INVOKABLE void resetTrafficStats();
+
+    /** 尚未取出的原始包数量 */
+    int pendingRawPackets() const;
+    /** 因环形缓冲区已满而丢弃的原始包数量 */
+    quint64 droppedRawPackets() const;
+
 signals:
     void reconnectCountChanged();
     void autoReconnectChanged();
     void openStatusChanged(bool opened);
     void reconnectAttemptsChanged(int attempts);
-    /** 接收到原始数据（仅 Raw 高级模式） */
+    void rawFlushThresholdBytesChanged();
+    void rawFlushLatencyMsChanged();
+    void bandwidthBytesPerSecondChanged();
+    void assignedSystemIdsChanged();
+    void statsIntervalMsChanged();
+    /**
+     * @brief 流量统计周期性刷新（计数无变化的周期不发射）
+     */
+    void trafficStatsChanged();
+    /**
+     * @brief 有待取出的原始包（仅 Raw 高级模式）
+     *
+     * 每批次只发射一次，在槽中调用 drainRawPackets() 取出。
+     */
+    void rawDataReady();
+    /**
+     * @brief 接收到原始数据（仅 Raw 高级模式，兼容接口）
+     *
+     * 仅在有连接时发射，每次刷新按 rawFlushThresholdBytes 合并为
+     * 若干帧；只包含 rawDataReady 处理之后仍未取出的数据。
+     */
     void rawDataReceived(const QByteArray &data);
 
 private slots:
-    void emitRawDataReceived(const QByteArray &data);
+    void handleRawDataReady();
+    void flushRawData();
+    void updateTrafficStats();
 
 private:
     friend class QLinkManagerPrivate;
+    friend class QGroundControlStationPrivate;
     explicit QDataLink(LinkKind kind, const QString &connStr,
                        QObject *parent = nullptr);
     QString connectionString() const { return m_connectionString; }
     void setOpened(bool opened);
     void setReconnectAttempts(int attempts);
+    std::shared_ptr<QRawPacketRing> rawPacketRing() const { return m_rawRing; }
+    std::shared_ptr<QLinkTrafficCounters> trafficCounters() const
+    {
+        return m_traffic;
+    }
 
     LinkKind m_linkKind;
     QString m_connectionString;
@@ -68,6 +211,22 @@ private:
     bool m_autoReconnect{false};
     bool m_opened{true};
     int m_reconnectAttempts{0};
+    std::shared_ptr<QRawPacketRing> m_rawRing; ///< Raw 模式待发送包
+    QByteArray m_rawFrame;                     ///< 合并帧缓冲（复用）
+    QTimer *m_rawFlushTimer{nullptr};
+    int m_rawFlushThresholdBytes{0};
+    int m_rawFlushLatencyMs{0};
+    int m_bandwidthBytesPerSecond{0};
+    QList<int> m_assignedSystemIds;
+    std::shared_ptr<QLinkTrafficCounters> m_traffic; ///< 收发路径上的原子计数
+    QTimer *m_statsTimer{nullptr};
+    QElapsedTimer m_statsElapsed;
+    int m_statsIntervalMs{1000};
+    quint64 m_lastPacketsReceived{0};
+    quint64 m_lastPacketsSent{0};
+    quint64 m_lastStatsChecksum{0};
+    double m_receivePacketsPerSecond{0.0};
+    double m_sendPacketsPerSecond{0.0};
 };
 
 #endif // QDATALINK_H
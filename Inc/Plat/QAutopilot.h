@@ -7,13 +7,22 @@
 #include "Common/QAttitude.h"
 #include "Common/QVelocity.h"
 #include "Common/QRawGps.h"
+#include "Common/QLatencyStats.h"
 #include "AirLine/QMissionPoint.h"
 #include "Plat/QAutopilotStatus.h"
 #include "Plat/QAutopilotFixedwing.h"
 #include "Plat/QAutoVehicleType.h"
+#include "Plat/QCommandStats.h"
 #include "MiniGCSExport.h"
 
 #include <QVector>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+struct QAutopilotTelemetryState;
+struct QAutopilotTelemetryChanges;
+class QCommandMetrics;
 
 /**
  * @brief QAutopilot - 具备自动驾驶能力的飞行平台
@@ -49,6 +58,7 @@ class MINIGCS_EXPORT QAutopilot : public QPlat
     Q_PROPERTY(QString vehicleName READ vehicleName NOTIFY vehicleNameChanged)
     Q_PROPERTY(QAutoVehicleType::Autopilot autopilotType READ autopilotType WRITE setAutopilotType NOTIFY autopilotTypeChanged)
     Q_PROPERTY(QString autopilotName READ autopilotName NOTIFY autopilotNameChanged)
+    Q_PROPERTY(TelemetryProfile telemetryProfile READ telemetryProfile WRITE setTelemetryProfile NOTIFY telemetryProfileChanged)
 
 public:
     enum ActionCommand {
@@ -88,6 +98,17 @@ public:
     };
     Q_ENUM(LandedState)
 
+    /**
+     * @brief 遥测频率档位；各档位把 Telemetry/<流>Hz 乘以
+     *        TelemetryProfile/<档位>Scale 后下发给飞控
+     */
+    enum TelemetryProfile {
+        TelemetryProfileFocused = 0,   ///< 操作员正在关注的飞机
+        TelemetryProfileBackground,    ///< 后台飞行的飞机
+        TelemetryProfileIdleOnGround   ///< 地面待命的飞机
+    };
+    Q_ENUM(TelemetryProfile)
+
     explicit QAutopilot(QObject *parent = nullptr);
     ~QAutopilot();
 
@@ -146,6 +167,28 @@ public:
     QString autopilotName() const;
     void setAutopilotType(QAutoVehicleType::Autopilot autopilotType);
 
+    TelemetryProfile telemetryProfile() const { return m_telemetryProfile; }
+    /** 切换档位后由地面站按新档位排队重发全部遥测频率，与预算重算合并为一轮 */
+    void setTelemetryProfile(TelemetryProfile profile);
+
+    /**
+     * @brief 各遥测流从 MAVSDK 回调到变化信号发射的延迟
+     *
+     * 按流在一次归并中最早到达的样本计时，包含合并刷新间隔、工作线程与
+     * 跨线程排队；去重后未发射信号的样本不计入。
+     */
+    Q_INVOKABLE QList<QLatencyStats> telemetryLatencyStats() const;
+    Q_INVOKABLE void resetTelemetryLatencyStats();
+
+    /**
+     * @brief 各类命令（动作与扩展 MAV_CMD）的往返延迟、重发与结果计数
+     *
+     * 延迟从发出命令到应答到达接收线程；重发按发往本机的同一 MAV_CMD
+     * 帧数推算，与同一 MAV_CMD 的其他命令重叠的那几次不计重发。
+     */
+    Q_INVOKABLE QList<QCommandStats> commandStats() const;
+    Q_INVOKABLE void resetCommandStats();
+
 signals:
     /** 业务控制命令完成（确认、拒绝或超时） */
     void actionCommandFinished(
@@ -172,6 +215,7 @@ signals:
     void vehicleNameChanged();
     void autopilotTypeChanged(QAutoVehicleType::Autopilot autopilotType);
     void autopilotNameChanged();
+    void telemetryProfileChanged(QAutopilot::TelemetryProfile profile);
 
     /** 航线下载完成；航点高度为相对起飞点高度 */
     void airLineDownloaded(const QList<QGpsPosition> &waypoints);
@@ -188,37 +232,23 @@ signals:
     void airLinePauseFailed(const QString &reason);
     void missionProgressChanged();
 
+protected:
+    /**
+     * @brief 跟踪按需遥测信号的接收者
+     *
+     * attitudeChanged、rawGpsChanged、homePositionChanged、fixedwingChanged
+     * 有接收者（含 QML 属性绑定）时才订阅对应遥测并请求消息频率。
+     */
+    void connectNotify(const QMetaMethod &signal) override;
+    void disconnectNotify(const QMetaMethod &signal) override;
+
 private slots:
-    void positionUpdate(double dLon, double dLat, float dH,
-                        float relativeAltitudeM);
-    void nedUpdate(float dNorth, float dEast, float dDown,
-                   float velocityNorth, float velocityEast,
-                   float velocityDown);
     void armedUpdate(bool armed);
     void inAirUpdate(bool inAir);
-    void gpsInfoUpdate(int gpsCount, int gpsStatus);
-    void batteryUpdate(int batteryId, float temperatureC,
-                       float batteryVoltage, float batteryCurrentA,
-                       float consumedAh, float batteryRemaining,
-                       float timeRemainingS, int batteryFunction);
-    void rcStatusUpdate(bool isAvailable, float signalStrengthPercent);
-    void headingUpdate(double heading);
-    void attitudeUpdate(float rollDeg, float pitchDeg, float yawDeg);
     void flightModeUpdate(QAutopilot::FlightMode flightMode,
                           const QString &fallbackName);
     void landedStateUpdate(QAutopilot::LandedState landedState,
                            const QString &fallbackName);
-    void rawGpsUpdate(float hdop, float vdop, float velocityMS,
-                      float courseDeg, float horizontalUncertaintyM,
-                      float verticalUncertaintyM,
-                      float velocityUncertaintyMS,
-                      float headingUncertaintyDeg);
-    void healthUpdate(bool isGyrometerCalibrationOk, bool isAccelerometerCalibrationOk,
-                      bool isMagnetometerCalibrationOk, bool isLocalPositionOk,
-                      bool isGlobalPositionOk, bool isHomePositionOk, bool isArmable);
-    void homeUpdate(double dLon, double dLat, float dH);
-    void fixedwingUpdate(float airspeedMS, float throttlePercentage, float climbRateMS,
-                        float groundspeedMS, float headingDeg, float absoluteAltitudeM);
     void missionProgressUpdate(int current, int total);
     void missionActiveUpdate(bool active);
 
@@ -231,7 +261,11 @@ private:
     void completeAirLineUpload(quint64 requestId);
     void failAirLineUpload(quint64 requestId, const QString &reason);
     void cancelAirLineUpload();
-    void updateMovingState();
+    QAutopilotTelemetryState telemetryState() const;
+    /** 当前有接收者的按需遥测（QGCSConfigInternal::TelemetryRate 位） */
+    uint32_t observedTelemetryRates() const;
+    void scheduleTelemetryDemandUpdate();
+    void applyTelemetryChanges(const QAutopilotTelemetryChanges &changes);
     QAutopilotPrivate* d_func();
     const QAutopilotPrivate* d_func() const;
 
@@ -252,8 +286,6 @@ private:
     LandedState m_landedState{LandedStateUnknown};
     QString m_flightModeFallbackName;
     QString m_landedStateFallbackName;
-    int m_motionStartSamples{0};
-    int m_motionStopSamples{0};
     QAutoVehicleType::Vehicle m_vehicleType{QAutoVehicleType::Vehicle_Unknown};
     QAutoVehicleType::Autopilot m_autopilotType{QAutoVehicleType::Autopilot_Unknown};
     bool m_airLineDownloading{false};
@@ -263,6 +295,11 @@ private:
     int m_missionCurrent{0};
     int m_missionTotal{0};
     bool m_missionActive{false};
+    TelemetryProfile m_telemetryProfile{TelemetryProfileFocused};
+    std::atomic_bool m_telemetryDemandUpdatePending{false};
+    struct TelemetryLatency;
+    std::unique_ptr<TelemetryLatency> m_telemetryLatency; ///< 拥有者线程访问
+    std::unique_ptr<QCommandMetrics> m_commandMetrics; ///< 拥有者线程访问
 };
 
 #endif // _YTY_QAUTOPILOT_H
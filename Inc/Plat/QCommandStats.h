@@ -0,0 +1,77 @@
+#ifndef _YTY_QCOMMANDSTATS_H
+#define _YTY_QCOMMANDSTATS_H
+
+#include <QObject>
+#include <QString>
+#include <QMetaType>
+#include "Common/QLatencyStats.h"
+#include "MiniGCSExport.h"
+
+/**
+ * @brief 单类命令的往返统计
+ *
+ * 由 QAutopilot::commandStats() 返回。latency 只统计收到应答（接受或拒绝）
+ * 的命令，从发出到应答到达接收线程计时；超时与未能发出的命令只计数。
+ */
+class MINIGCS_EXPORT QCommandStats
+{
+    Q_GADGET
+    Q_PROPERTY(QString name READ name WRITE setName)
+    Q_PROPERTY(quint64 sent READ sent WRITE setSent)
+    Q_PROPERTY(quint64 accepted READ accepted WRITE setAccepted)
+    Q_PROPERTY(quint64 rejected READ rejected WRITE setRejected)
+    Q_PROPERTY(quint64 timedOut READ timedOut WRITE setTimedOut)
+    Q_PROPERTY(quint64 failed READ failed WRITE setFailed)
+    Q_PROPERTY(quint64 retries READ retries WRITE setRetries)
+    Q_PROPERTY(QLatencyStats latency READ latency WRITE setLatency)
+
+public:
+    QCommandStats() = default;
+
+    /** 命令名：arm、takeoff 等动作名，或扩展命令的 MAV_CMD 名 */
+    QString name() const { return m_name; }
+    void setName(const QString &name);
+
+    quint64 sent() const { return m_sent; }
+    void setSent(quint64 sent);
+
+    /** 飞控应答 MAV_RESULT_ACCEPTED */
+    quint64 accepted() const { return m_accepted; }
+    void setAccepted(quint64 accepted);
+
+    /** 飞控应答拒绝、不支持或执行失败 */
+    quint64 rejected() const { return m_rejected; }
+    void setRejected(quint64 rejected);
+
+    /** 重发用尽仍未收到应答 */
+    quint64 timedOut() const { return m_timedOut; }
+    void setTimedOut(quint64 timedOut);
+
+    /** 未能发出（无系统、连接错误等） */
+    quint64 failed() const { return m_failed; }
+    void setFailed(quint64 failed);
+
+    /** 累计重发次数；不含与同一 MAV_CMD 命令重叠的发送 */
+    quint64 retries() const { return m_retries; }
+    void setRetries(quint64 retries);
+
+    QLatencyStats latency() const { return m_latency; }
+    void setLatency(const QLatencyStats &latency);
+
+    bool operator==(const QCommandStats &other) const;
+    bool operator!=(const QCommandStats &other) const;
+
+private:
+    QString m_name;
+    quint64 m_sent{0};
+    quint64 m_accepted{0};
+    quint64 m_rejected{0};
+    quint64 m_timedOut{0};
+    quint64 m_failed{0};
+    quint64 m_retries{0};
+    QLatencyStats m_latency;
+};
+
+Q_DECLARE_METATYPE(QCommandStats)
+
+#endif // _YTY_QCOMMANDSTATS_H
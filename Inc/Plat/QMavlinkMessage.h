@@ -0,0 +1,57 @@
+#ifndef _YTY_QMAVLINKMESSAGE_H
+#define _YTY_QMAVLINKMESSAGE_H
+
+#include <QObject>
+#include <QMetaType>
+#include <QString>
+#include <QVariantMap>
+#include "MiniGCSExport.h"
+
+/**
+ * @brief 按扩展方言解码的一条 MAVLink 消息
+ *
+ * 由 QPlat::messageReceived 发出。fields 以字段名为键：整数为 int / uint /
+ * qlonglong / qulonglong，浮点保持 float / double，char 数组为 QString，
+ * 其它数组为 QVariantList。
+ */
+class MINIGCS_EXPORT QMavlinkMessage
+{
+    Q_GADGET
+    Q_PROPERTY(QString name READ name WRITE setName)
+    Q_PROPERTY(int messageId READ messageId WRITE setMessageId)
+    Q_PROPERTY(int systemId READ systemId WRITE setSystemId)
+    Q_PROPERTY(int componentId READ componentId WRITE setComponentId)
+    Q_PROPERTY(QVariantMap fields READ fields WRITE setFields)
+
+public:
+    QMavlinkMessage() = default;
+
+    QString name() const { return m_name; }
+    void setName(const QString &name);
+
+    int messageId() const { return m_messageId; }
+    void setMessageId(int messageId);
+
+    int systemId() const { return m_systemId; }
+    void setSystemId(int systemId);
+
+    int componentId() const { return m_componentId; }
+    void setComponentId(int componentId);
+
+    QVariantMap fields() const { return m_fields; }
+    void setFields(const QVariantMap &fields);
+
+    bool operator==(const QMavlinkMessage &other) const;
+    bool operator!=(const QMavlinkMessage &other) const;
+
+private:
+    QString m_name;
+    int m_messageId{-1};
+    int m_systemId{0};
+    int m_componentId{0};
+    QVariantMap m_fields;
+};
+
+Q_DECLARE_METATYPE(QMavlinkMessage)
+
+#endif // _YTY_QMAVLINKMESSAGE_H
@@ -0,0 +1,58 @@
+#ifndef _YTY_QMAVLINKMESSAGERATE_H
+#define _YTY_QMAVLINKMESSAGERATE_H
+
+#include <QObject>
+#include <QDateTime>
+#include <QMetaType>
+#include "MiniGCSExport.h"
+
+/**
+ * @brief 单个 MAVLink 消息 ID 的接收统计
+ *
+ * 由 QPlat::messageRates() 返回，用于核对 set_rate_* 请求是否生效、
+ * 找出占用链路的消息。
+ */
+class MINIGCS_EXPORT QMavlinkMessageRate
+{
+    Q_GADGET
+    Q_PROPERTY(int messageId READ messageId WRITE setMessageId)
+    Q_PROPERTY(quint64 packets READ packets WRITE setPackets)
+    Q_PROPERTY(quint64 bytes READ bytes WRITE setBytes)
+    Q_PROPERTY(double rateHz READ rateHz WRITE setRateHz)
+    Q_PROPERTY(QDateTime lastReceiveTime READ lastReceiveTime WRITE setLastReceiveTime)
+
+public:
+    QMavlinkMessageRate() = default;
+
+    int messageId() const { return m_messageId; }
+    void setMessageId(int messageId);
+
+    /** 累计收到的包数 */
+    quint64 packets() const { return m_packets; }
+    void setPackets(quint64 packets);
+
+    /** 累计线上字节数（含帧头与校验） */
+    quint64 bytes() const { return m_bytes; }
+    void setBytes(quint64 bytes);
+
+    /** 最近 1 秒窗口的接收频率 */
+    double rateHz() const { return m_rateHz; }
+    void setRateHz(double rateHz);
+
+    QDateTime lastReceiveTime() const { return m_lastReceiveTime; }
+    void setLastReceiveTime(const QDateTime &time);
+
+    bool operator==(const QMavlinkMessageRate &other) const;
+    bool operator!=(const QMavlinkMessageRate &other) const;
+
+private:
+    int m_messageId{-1};
+    quint64 m_packets{0};
+    quint64 m_bytes{0};
+    double m_rateHz{0.0};
+    QDateTime m_lastReceiveTime;
+};
+
+Q_DECLARE_METATYPE(QMavlinkMessageRate)
+
+#endif // _YTY_QMAVLINKMESSAGERATE_H
@@ -5,10 +5,14 @@
 #include <QString>
 #include <QVector>
 #include <QDateTime>
+#include <QList>
 #include <memory>
 #include "MiniGCSExport.h"
+#include "Plat/QMavlinkMessageRate.h"
+#include "Plat/QMavlinkMessage.h"
 
 class QPlatPrivate;
+struct QMessageSubscriptions;
 class QGroundControlStation;
 /**
  * @brief QPlat - 飞行平台基类
@@ -42,12 +46,42 @@ public:
     void setLastDisconnectedTime(const QDateTime &time);
     QString toString() const;
 
+    /**
+     * @brief 该平台按消息 ID 的接收统计，按消息 ID 升序
+     *
+     * 在 MAVSDK 接收线程上用固定大小的计数表累计，调用时只读取计数。
+     */
+    Q_INVOKABLE QList<QMavlinkMessageRate> messageRates() const;
+    /** 累计收到的包数（全部组件） */
+    Q_INVOKABLE quint64 receivedPackets() const;
+    /** 按各组件 MAVLink 序号跳变估计的丢包数 */
+    Q_INVOKABLE quint64 lostPackets() const;
+    /** 丢包占应收包的百分比 */
+    Q_INVOKABLE double packetLossPercent() const;
+    Q_INVOKABLE void resetMessageStats();
+
+    /**
+     * @brief 订阅扩展方言中的一种消息，收到时发出 messageReceived
+     * @param messageName 消息名，须在 MessageExtension/File 的 <messages> 中定义
+     * @param maxRateHz 最高投递频率；不大于 0 时不限频
+     * @return 订阅 ID；消息未定义或平台尚未绑定时返回 0
+     *
+     * MAVSDK 已编译该消息时在接收线程按二进制布局解码，否则经 MavlinkDirect
+     * 的 JSON 字段转换。限频在接收线程、解码与跨线程投递之前进行。
+     * 订阅在平台重新绑定系统后保持有效。
+     */
+    Q_INVOKABLE int subscribeMessage(const QString &messageName,
+                                     double maxRateHz = 0.0);
+    Q_INVOKABLE void unsubscribeMessage(int subscriptionId);
+
 signals:
     void connectionStatusChanged(bool connected);
     void infoUpdated();
     /** 平台组件集合发生变化 */
     void componentsChanged();
     void errorInfo(const QString& sError);
+    /** subscribeMessage() 订阅的消息 */
+    void messageReceived(int subscriptionId, const QMavlinkMessage &message);
 
 protected slots:
     void updateConnection(bool bConnected);
@@ -67,6 +101,7 @@ protected:
     int       m_vehicleId{-1};
 
     std::unique_ptr<QPlatPrivate> d_ptr;
+    std::unique_ptr<QMessageSubscriptions> m_messageSubscriptions;
 };
 
 #endif // _YTY_QSTANDALONE_H
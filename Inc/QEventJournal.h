@@ -0,0 +1,39 @@
+#ifndef QEVENTJOURNAL_H
+#define QEVENTJOURNAL_H
+
+#include <QList>
+#include <QString>
+#include <limits>
+#include "Common/QJournalEvent.h"
+#include "MiniGCSExport.h"
+
+/**
+ * @brief 二进制事件日志的读取接口
+ *
+ * 命令结果、模式与解锁变化、连接变化、链路错误与重连等事件在写文本日志的同时
+ * 以定长记录写入 Journal/File 指定的环形文件。读取通过内存映射完成，
+ * 可以读取本进程或其他进程正在写入的文件；正在写入的记录会被跳过。
+ */
+class MINIGCS_EXPORT QEventJournal
+{
+public:
+    /**
+     * @brief 当前写入的日志文件（绝对路径）；未开启时为空
+     */
+    static QString activeFile();
+
+    /**
+     * @brief 读取日志文件中的事件，按写入顺序返回
+     * @param path 日志文件；为空时读取 activeFile()
+     * @param systemId 只返回该系统的事件；小于 0 时不按系统过滤
+     * @param fromMs 起始时间（含），自纪元起毫秒
+     * @param toMs 结束时间（含），自纪元起毫秒
+     *
+     * 文件不存在或格式不符时返回空列表。
+     */
+    static QList<QJournalEvent> read(
+        const QString &path = QString(), int systemId = -1, qint64 fromMs = 0,
+        qint64 toMs = std::numeric_limits<qint64>::max());
+};
+
+#endif // QEVENTJOURNAL_H
@@ -3,6 +3,7 @@
 
 #include <QObject>
 #include <QString>
+#include <QStringList>
 #include <cstdint>
 #include "MiniGCSExport.h"
 
@@ -13,6 +14,8 @@ struct QGCSConfigPrivateAccess;
  * @brief QGCSConfig - 配置单例
  *
  * 管理应用程序 INI 配置：地面站身份、日志、类型文本目录等业务可选项。
+ * 地面站身份、时间同步与运动判定阈值在 init()/save()/reload() 时读入只读快照，
+ * 对应 getter 只读快照字段，可在遥测与命令热路径上直接调用。
  */
 class MINIGCS_EXPORT QGCSConfig:public QObject
 {
@@ -41,6 +44,11 @@ public:
 
     QString logLevel() const;
 
+    /** 异步日志队列满时被覆盖丢弃的日志条数（同步模式恒为 0） */
+    quint64 droppedLogMessages() const;
+    /** 界面线程积压过多而未转发为 warningLogMessage 的日志条数 */
+    quint64 droppedWarningMessages() const;
+
     /** 地面站身份 ID（配置文件设置） */
     uint8_t stationId() const;
     /** 地面站组件 ID（配置文件设置） */
@@ -74,6 +82,8 @@ public:
 signals:
     /**
      * @brief warning 及以上级别的格式化业务日志
+     *
+     * 日志线程按批投递到 QGCSConfig 所在线程，同一批在一次事件循环中依次发射。
      * @param level 日志级别（实现侧数值，仅用于过滤展示）
      * @param message 已格式化的日志文本
      */
@@ -85,6 +95,14 @@ signals:
     void firmwareWarningMessage(
         quint32 vehicleId, const QString &message);
 
+    /**
+     * @brief reload() 后内容发生变化的配置键
+     *
+     * 配置文件在磁盘上被修改时会自动调用 reload()。
+     * @param keys 新增、删除或值变化的键（如 "Telemetry/PositionHz"）
+     */
+    void settingsChanged(const QStringList &keys);
+
 protected:
     QGCSConfig(QObject* parent=nullptr);
     virtual ~QGCSConfig();
@@ -98,6 +116,7 @@ private:
     Q_DISABLE_COPY(QGCSConfig)
 
     void init_logging();
+    void watchConfigFile();
 
     static QGCSConfig* m_pSInsatance;
 };
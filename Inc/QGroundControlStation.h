@@ -49,6 +49,7 @@ private:
     friend class QGroundControlStationPrivate;
     friend class QLinkManagerPrivate;
     friend class QDataLink;
+    friend class QAutopilotPrivate;
     std::unique_ptr<QGroundControlStationPrivate> d_ptr;
     QLinkManager *m_linkManager{nullptr};
     QMap<uint8_t, QPlat*> m_mapId2Standalone;
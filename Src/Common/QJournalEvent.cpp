@@ -0,0 +1,50 @@
+#include "Common/QJournalEvent.h"
+
+void QJournalEvent::setSequence(quint64 sequence)
+{
+    m_sequence = sequence;
+}
+
+void QJournalEvent::setTimestampMs(qint64 timestampMs)
+{
+    m_timestampMs = timestampMs;
+}
+
+void QJournalEvent::setSystemId(int systemId)
+{
+    m_systemId = systemId;
+}
+
+void QJournalEvent::setComponentId(int componentId)
+{
+    m_componentId = componentId;
+}
+
+void QJournalEvent::setType(Type type)
+{
+    m_type = type;
+}
+
+void QJournalEvent::setCode(int code)
+{
+    m_code = code;
+}
+
+void QJournalEvent::setValue(qint64 value)
+{
+    m_value = value;
+}
+
+bool QJournalEvent::operator==(const QJournalEvent &other) const
+{
+    return m_sequence == other.m_sequence &&
+           m_timestampMs == other.m_timestampMs &&
+           m_systemId == other.m_systemId &&
+           m_componentId == other.m_componentId && m_type == other.m_type &&
+           m_code == other.m_code && m_value == other.m_value;
+}
+
+bool QJournalEvent::operator!=(const QJournalEvent &other) const
+{
+    return !(*this == other);
+}
@@ -0,0 +1,54 @@
+#include "Common/QLatencyStats.h"
+
+void QLatencyStats::setName(const QString &name)
+{
+    m_name = name;
+}
+
+void QLatencyStats::setCount(quint64 count)
+{
+    m_count = count;
+}
+
+void QLatencyStats::setMinMs(double ms)
+{
+    m_minMs = ms;
+}
+
+void QLatencyStats::setMeanMs(double ms)
+{
+    m_meanMs = ms;
+}
+
+void QLatencyStats::setP50Ms(double ms)
+{
+    m_p50Ms = ms;
+}
+
+void QLatencyStats::setP90Ms(double ms)
+{
+    m_p90Ms = ms;
+}
+
+void QLatencyStats::setP99Ms(double ms)
+{
+    m_p99Ms = ms;
+}
+
+void QLatencyStats::setMaxMs(double ms)
+{
+    m_maxMs = ms;
+}
+
+bool QLatencyStats::operator==(const QLatencyStats &other) const
+{
+    return m_name == other.m_name && m_count == other.m_count &&
+           m_minMs == other.m_minMs && m_meanMs == other.m_meanMs &&
+           m_p50Ms == other.m_p50Ms && m_p90Ms == other.m_p90Ms &&
+           m_p99Ms == other.m_p99Ms && m_maxMs == other.m_maxMs;
+}
+
+bool QLatencyStats::operator!=(const QLatencyStats &other) const
+{
+    return !(*this == other);
+}
@@ -0,0 +1,62 @@
+#ifndef DIALECTCATALOG_H
+#define DIALECTCATALOG_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief 构建期生成的方言目录的条目类型
+ *
+ * 数据由 cmake/GenerateDialectCatalog.cmake 生成到构建目录的
+ * Generated/DefaultDialectCatalog.h，内容与 XmlToMavSDK::loadXml 解析同一文件的结果一致，
+ * 默认方言加载时直接从这里填表，不读文件、不解析 XML。
+ */
+namespace DialectCatalog {
+
+struct Param {
+    int index;
+    const char* label;
+};
+
+struct Command {
+    const char* name;
+    uint16_t value;
+    const char* description;
+    uint32_t firstParam; ///< 在 Params 中的起始下标
+    uint32_t paramCount;
+};
+
+struct Field {
+    const char* name;
+    const char* type; ///< XML 中的类型文本，如 "uint16_t"、"char[50]"
+    bool extension;
+};
+
+/**
+ * @brief 消息及其字段（声明顺序），线上布局在加载时计算
+ */
+struct Message {
+    const char* name;
+    uint32_t id;
+    uint32_t firstField; ///< 在 Fields 中的起始下标
+    uint32_t fieldCount;
+};
+
+/** 命令表按名称严格升序（无重名） */
+template<std::size_t N>
+constexpr bool isSortedByName(const std::array<Command, N>& commands)
+{
+    for (std::size_t index = 1; index < N; ++index) {
+        if (!(std::string_view(commands[index - 1].name) <
+              std::string_view(commands[index].name))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace DialectCatalog
+
+#endif // DIALECTCATALOG_H
@@ -1,10 +1,180 @@
+#include <QCryptographicHash>
 #include <QDebug>
 #include <QFile>
 #include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QXmlStreamReader>
+#include <algorithm>
+#include <array>
+#include <cstring>
 
 #include "Extern/XmlToMavSDK.h"
+#include "Generated/DefaultDialectCatalog.h"
 #include "QGCSConfig.h"
+#include "Private/QGCSTrace.h"
+
+static_assert(DialectCatalog::isSortedByName(DefaultDialectCatalog::Commands),
+              "generated MAV_CMD catalog must be sorted by name");
+
+namespace {
+using FieldType = XmlToMavSDK::FieldType;
+
+struct FieldTypeName {
+    const char* name;
+    FieldType type;
+};
+
+constexpr FieldTypeName FieldTypeNames[] = {
+    {"char", FieldType::Char},     {"int8_t", FieldType::Int8},
+    {"uint8_t", FieldType::UInt8}, {"int16_t", FieldType::Int16},
+    {"uint16_t", FieldType::UInt16}, {"int32_t", FieldType::Int32},
+    {"uint32_t", FieldType::UInt32}, {"int64_t", FieldType::Int64},
+    {"uint64_t", FieldType::UInt64}, {"float", FieldType::Float},
+    {"double", FieldType::Double},
+};
+
+/// MAVLink 载荷上限
+constexpr std::size_t MaxPayloadLength = 255;
+
+int fieldTypeSize(FieldType type)
+{
+    switch (type) {
+    case FieldType::Char:
+    case FieldType::Int8:
+    case FieldType::UInt8:
+        return 1;
+    case FieldType::Int16:
+    case FieldType::UInt16:
+        return 2;
+    case FieldType::Int32:
+    case FieldType::UInt32:
+    case FieldType::Float:
+        return 4;
+    case FieldType::Int64:
+    case FieldType::UInt64:
+    case FieldType::Double:
+        return 8;
+    }
+    return 1;
+}
+
+/// 解析 "uint16_t"、"char[50]"、"uint8_t_mavlink_version" 等类型名
+bool parseFieldType(QString text, XmlToMavSDK::MessageField& field)
+{
+    text = text.trimmed();
+    const qsizetype bracket = text.indexOf(QLatin1Char('['));
+    if (bracket >= 0) {
+        bool ok = false;
+        const int length =
+            text.mid(bracket + 1, text.size() - bracket - 2).toInt(&ok);
+        if (!ok || length <= 0 || !text.endsWith(QLatin1Char(']'))) {
+            return false;
+        }
+        field.arrayLength = static_cast<uint16_t>(length);
+        text.truncate(bracket);
+    }
+    if (text == QLatin1String("uint8_t_mavlink_version")) {
+        text = QStringLiteral("uint8_t");
+    }
+    for (const FieldTypeName& entry : FieldTypeNames) {
+        if (text == QLatin1String(entry.name)) {
+            field.type = entry.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+/// 按生成器规则排出线上顺序并计算偏移；超出载荷上限时返回 false
+bool layoutMessage(XmlToMavSDK::MessageSchema& schema)
+{
+    const auto firstExtension = std::find_if(
+        schema.fields.begin(), schema.fields.end(),
+        [](const XmlToMavSDK::MessageField& field) { return field.extension; });
+    std::stable_sort(schema.fields.begin(), firstExtension,
+                     [](const XmlToMavSDK::MessageField& left,
+                        const XmlToMavSDK::MessageField& right) {
+                         return fieldTypeSize(left.type) >
+                                fieldTypeSize(right.type);
+                     });
+    std::size_t offset = 0;
+    for (XmlToMavSDK::MessageField& field : schema.fields) {
+        field.offset = static_cast<uint16_t>(offset);
+        offset += static_cast<std::size_t>(fieldTypeSize(field.type)) *
+                  std::max<uint16_t>(field.arrayLength, 1);
+    }
+    if (offset == 0 || offset > MaxPayloadLength) {
+        return false;
+    }
+    schema.payloadLength = static_cast<uint16_t>(offset);
+    return true;
+}
+
+template<typename T>
+T readValue(const uint8_t* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+QVariant scalarValue(FieldType type, const uint8_t* data)
+{
+    switch (type) {
+    case FieldType::Char:
+        return QString(QLatin1Char(static_cast<char>(*data)));
+    case FieldType::Int8:
+        return static_cast<int>(readValue<int8_t>(data));
+    case FieldType::UInt8:
+        return static_cast<uint>(*data);
+    case FieldType::Int16:
+        return static_cast<int>(readValue<int16_t>(data));
+    case FieldType::UInt16:
+        return static_cast<uint>(readValue<uint16_t>(data));
+    case FieldType::Int32:
+        return static_cast<int>(readValue<int32_t>(data));
+    case FieldType::UInt32:
+        return static_cast<uint>(readValue<uint32_t>(data));
+    case FieldType::Int64:
+        return static_cast<qlonglong>(readValue<int64_t>(data));
+    case FieldType::UInt64:
+        return static_cast<qulonglong>(readValue<uint64_t>(data));
+    case FieldType::Float:
+        return readValue<float>(data);
+    case FieldType::Double:
+        return readValue<double>(data);
+    }
+    return {};
+}
+
+QVariant jsonScalarValue(FieldType type, const QJsonValue& value)
+{
+    switch (type) {
+    case FieldType::Char:
+        return value.toString();
+    case FieldType::Int8:
+    case FieldType::Int16:
+    case FieldType::Int32:
+        return static_cast<int>(value.toInteger());
+    case FieldType::UInt8:
+    case FieldType::UInt16:
+    case FieldType::UInt32:
+        return static_cast<uint>(value.toInteger());
+    case FieldType::Int64:
+        return static_cast<qlonglong>(value.toInteger());
+    case FieldType::UInt64:
+        /// 经 QVariant 取整数，不经 double，避免超过 2^53 时丢精度
+        return value.toVariant().toULongLong();
+    case FieldType::Float:
+        return static_cast<float>(value.toDouble());
+    case FieldType::Double:
+        return value.toDouble();
+    }
+    return {};
+}
+} // namespace
 
 XmlToMavSDK::XmlToMavSDK(const QString& xmlPath)
 {
@@ -19,6 +189,30 @@ bool XmlToMavSDK::isDefaultArdupilotDialectFile(const QString& xmlPath)
                QStringLiteral("ardupilotmega.xml"), Qt::CaseInsensitive) == 0;
 }
 
+bool XmlToMavSDK::matchesDefaultCatalog(const QString& xmlPath)
+{
+    if (!DefaultDialectCatalog::Available ||
+        !isDefaultArdupilotDialectFile(xmlPath)) {
+        return false;
+    }
+
+    /// 文件缺失时仍按内嵌方言处理；能读到则必须与构建期所用文件逐字节一致
+    QFile file(xmlPath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return true;
+    }
+    const QByteArray sha256 =
+        QCryptographicHash::hash(file.readAll(), QCryptographicHash::Sha256)
+            .toHex();
+    const std::string_view expected = DefaultDialectCatalog::SourceSha256;
+    if (sha256 == QByteArray(expected.data(), static_cast<int>(expected.size()))) {
+        return true;
+    }
+    qInfo() << "Dialect xml differs from the built-in catalog, parsing:"
+            << xmlPath;
+    return false;
+}
+
 const XmlToMavSDK::ExternCmd* XmlToMavSDK::findCmd(const QString& name) const
 {
     auto it = m_mapExternCMDs.find(name);
@@ -33,6 +227,179 @@ QStringList XmlToMavSDK::listCmdNames() const
     return m_mapExternCMDs.keys();
 }
 
+std::shared_ptr<const XmlToMavSDK::MessageSchema> XmlToMavSDK::findMessage(
+    const QString& name) const
+{
+    return m_messagesByName.value(name);
+}
+
+std::shared_ptr<const XmlToMavSDK::MessageSchema> XmlToMavSDK::findMessage(
+    uint32_t messageId) const
+{
+    return m_messagesById.value(messageId);
+}
+
+QStringList XmlToMavSDK::listMessageNames() const
+{
+    return m_messagesByName.keys();
+}
+
+QVariantMap XmlToMavSDK::decodePayload(const MessageSchema& schema,
+                                       const uint8_t* payload,
+                                       std::size_t length)
+{
+    /// 截断的末尾补 0 后统一按偏移读取
+    std::array<uint8_t, MaxPayloadLength> buffer{};
+    if (payload && length > 0) {
+        std::memcpy(buffer.data(), payload,
+                    std::min<std::size_t>(length, schema.payloadLength));
+    }
+
+    QVariantMap fields;
+    for (const MessageField& field : schema.fields) {
+        const uint8_t* data = buffer.data() + field.offset;
+        if (field.arrayLength == 0) {
+            fields.insert(field.name, scalarValue(field.type, data));
+        } else if (field.type == FieldType::Char) {
+            const char* text = reinterpret_cast<const char*>(data);
+            fields.insert(field.name,
+                          QString::fromUtf8(
+                              text, static_cast<qsizetype>(
+                                        qstrnlen(text, field.arrayLength))));
+        } else {
+            const int size = fieldTypeSize(field.type);
+            QVariantList values;
+            values.reserve(field.arrayLength);
+            for (int index = 0; index < field.arrayLength; ++index) {
+                values.append(scalarValue(field.type, data + index * size));
+            }
+            fields.insert(field.name, values);
+        }
+    }
+    return fields;
+}
+
+QVariantMap XmlToMavSDK::decodeFieldsJson(const MessageSchema& schema,
+                                          const std::string& fieldsJson)
+{
+    QVariantMap fields;
+    const QJsonObject object =
+        QJsonDocument::fromJson(QByteArray::fromStdString(fieldsJson))
+            .object();
+    for (const MessageField& field : schema.fields) {
+        const QJsonValue value = object.value(field.name);
+        if (field.arrayLength == 0 || field.type == FieldType::Char) {
+            fields.insert(field.name, jsonScalarValue(field.type, value));
+            continue;
+        }
+        const QJsonArray array = value.toArray();
+        QVariantList values;
+        values.reserve(field.arrayLength);
+        for (int index = 0; index < field.arrayLength; ++index) {
+            values.append(jsonScalarValue(field.type, array.at(index)));
+        }
+        fields.insert(field.name, values);
+    }
+    return fields;
+}
+
+void XmlToMavSDK::compileMessages(const QByteArray& data)
+{
+    QXmlStreamReader xml(data);
+    MessageSchema schema;
+    bool inMessage = false;
+    bool inExtensions = false;
+    bool valid = false;
+    while (!xml.atEnd() && !xml.hasError()) {
+        xml.readNext();
+        if (xml.isStartElement()) {
+            if (xml.name() == QLatin1String("message")) {
+                schema = MessageSchema{};
+                schema.name =
+                    xml.attributes().value(QLatin1String("name")).toString();
+                schema.id = xml.attributes()
+                                .value(QLatin1String("id"))
+                                .toString()
+                                .toUInt(&valid);
+                valid = valid && !schema.name.isEmpty();
+                inMessage = true;
+                inExtensions = false;
+            } else if (inMessage && xml.name() == QLatin1String("extensions")) {
+                inExtensions = true;
+            } else if (inMessage && xml.name() == QLatin1String("field")) {
+                MessageField field;
+                field.name =
+                    xml.attributes().value(QLatin1String("name")).toString();
+                field.extension = inExtensions;
+                if (!parseFieldType(
+                        xml.attributes().value(QLatin1String("type")).toString(),
+                        field)) {
+                    qWarning() << "Unsupported field type in message"
+                               << schema.name << field.name;
+                    valid = false;
+                }
+                schema.fields.append(field);
+            }
+        } else if (inMessage && xml.isEndElement() &&
+                   xml.name() == QLatin1String("message")) {
+            inMessage = false;
+            if (valid) {
+                addMessage(std::move(schema));
+            }
+        }
+    }
+}
+
+void XmlToMavSDK::addMessage(MessageSchema schema)
+{
+    if (!layoutMessage(schema)) {
+        return;
+    }
+    const auto compiled =
+        std::make_shared<const MessageSchema>(std::move(schema));
+    m_messagesByName.insert(compiled->name, compiled);
+    m_messagesById.insert(compiled->id, compiled);
+}
+
+void XmlToMavSDK::loadDefaultCatalog()
+{
+    using namespace DefaultDialectCatalog;
+
+    /// 生成的命令表已按名称排好序，逐条追加到末尾
+    for (const Command& entry : Commands) {
+        ExternCmd cmd;
+        cmd.name = QString::fromLatin1(entry.name);
+        cmd.value = entry.value;
+        cmd.description = QString::fromUtf8(entry.description);
+        cmd.params.reserve(static_cast<qsizetype>(entry.paramCount));
+        for (uint32_t index = 0; index < entry.paramCount; ++index) {
+            const Param& param = Params[entry.firstParam + index];
+            cmd.params.append(
+                CommandParam{QString::fromUtf8(param.label), param.index});
+        }
+        m_mapExternCMDs.insert(m_mapExternCMDs.cend(), cmd.name, cmd);
+    }
+
+    for (const Message& entry : Messages) {
+        MessageSchema schema;
+        schema.name = QString::fromLatin1(entry.name);
+        schema.id = entry.id;
+        bool valid = true;
+        for (uint32_t index = 0; index < entry.fieldCount; ++index) {
+            const Field& source = Fields[entry.firstField + index];
+            MessageField field;
+            field.name = QString::fromLatin1(source.name);
+            field.extension = source.extension;
+            valid = parseFieldType(QString::fromLatin1(source.type), field) &&
+                    valid;
+            schema.fields.append(field);
+        }
+        if (valid) {
+            addMessage(std::move(schema));
+        }
+    }
+}
+
 std::optional<mavsdk::MavlinkDirect::Result> XmlToMavSDK::applyCustomXmlOnce(
     mavsdk::MavlinkDirect& mavlinkDirect)
 {
@@ -110,13 +477,25 @@ mavsdk::MavlinkDirect::Result XmlToMavSDK::sendCmd(
 
 bool XmlToMavSDK::loadXml(const QString& xmlPath)
 {
+    QGCS_TRACE_SCOPE("xml", "loadXml");
     m_mapExternCMDs.clear();
+    m_messagesByName.clear();
+    m_messagesById.clear();
     m_xmlContent.clear();
     m_bCmdTableLoaded = false;
     m_needsMessageSetInject = false;
     m_customXmlApplied.store(false);
     m_customXmlApplyStarted.store(false);
 
+    /// ardupilotmega 已由 MAVSDK 内嵌，命令表与消息布局也已在构建期生成；
+    /// 同名但内容不同的文件按自定义方言在运行时解析
+    if (matchesDefaultCatalog(xmlPath)) {
+        loadDefaultCatalog();
+        m_bCmdTableLoaded = true;
+        m_customXmlApplied.store(true);
+        return true;
+    }
+
     QFile file(xmlPath);
     if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
         qWarning() << "Failed to open xml:" << xmlPath;
@@ -177,6 +556,7 @@ bool XmlToMavSDK::loadXml(const QString& xmlPath)
         return false;
     }
 
+    compileMessages(data);
     m_xmlContent = data.toStdString();
     m_bCmdTableLoaded = true;
     /// 非默认方言文件才需要写入共享 MessageSet；ardupilotmega 已由 MAVSDK 内嵌
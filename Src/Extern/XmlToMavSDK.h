@@ -3,7 +3,10 @@
 #include <QString>
 #include <QVector>
 #include <QMap>
+#include <QHash>
+#include <QVariantMap>
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -18,6 +21,10 @@
  * - 默认 ardupilotmega 方言已在 MAVSDK 启动时内嵌，本类主要解析 MAV_CMD 表供按名发送
  * - 仅当配置指向「额外」自定义 XML 时，才向共享 MessageSet 注入一次
  * - 每机 MavlinkDirect 只负责订阅/发送，不负责再加载方言
+ * - <messages> 编译为按线上顺序的字段偏移表，decodePayload 直接从二进制载荷取值
+ * - 默认 ardupilotmega.xml 的命令表与消息字段在构建期生成（DefaultDialectCatalog），
+ *   文件内容与构建期所用文件一致（SHA-256）时不解析、不保留 XML 文本；
+ *   同名但内容不同的文件与自定义方言一样在运行时解析
  */
 class XmlToMavSDK
 {
@@ -34,6 +41,44 @@ public:
         QVector<CommandParam> params;
     };
 
+    /**
+     * @brief 消息字段的线上类型
+     */
+    enum class FieldType : uint8_t {
+        Char,
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Float,
+        Double
+    };
+
+    struct MessageField {
+        QString name;
+        FieldType type{FieldType::UInt8};
+        uint16_t offset{0};      ///< 载荷内的字节偏移
+        uint16_t arrayLength{0}; ///< 数组元素数；0 表示标量
+        bool extension{false};
+    };
+
+    /**
+     * @brief 由 <message> 编译的载荷布局
+     *
+     * 与 MAVLink 生成器一致：非扩展字段按元素大小降序稳定排序，
+     * 扩展字段按声明顺序排在其后。fields 按线上顺序排列。
+     */
+    struct MessageSchema {
+        QString name;
+        uint32_t id{0};
+        uint16_t payloadLength{0}; ///< 含扩展字段的完整载荷长度
+        QVector<MessageField> fields;
+    };
+
     explicit XmlToMavSDK(const QString& xmlPath = QString());
 
     bool loadXml(const QString& xmlPath);
@@ -60,6 +105,34 @@ public:
     const ExternCmd* findCmd(const QString& name) const;
     QStringList listCmdNames() const;
 
+    /**
+     * @brief 查找方言中的消息布局；只含本文件 <messages> 中定义的消息
+     *
+     * 布局加载后不再修改，接收回调可直接持有返回的指针。
+     */
+    std::shared_ptr<const MessageSchema> findMessage(const QString& name) const;
+    std::shared_ptr<const MessageSchema> findMessage(uint32_t messageId) const;
+    QStringList listMessageNames() const;
+
+    /**
+     * @brief 按布局把二进制载荷解码为字段值（本机为小端）
+     *
+     * MAVLink 2 会截掉载荷末尾的 0，超出 length 的字节按 0 处理。整数按声明宽度
+     * 解码为 int / uint / qlonglong / qulonglong，float 与 double 保持原类型；
+     * char 数组解码为 QString（到第一个 0 为止），其它数组为 QVariantList。
+     */
+    static QVariantMap decodePayload(const MessageSchema& schema,
+                                     const uint8_t* payload,
+                                     std::size_t length);
+
+    /**
+     * @brief 把 MavlinkDirect 的 fields_json 按布局转换为与 decodePayload 相同的类型
+     *
+     * 仅用于 MAVSDK 未编译进 C 方言、拿不到二进制帧的消息。
+     */
+    static QVariantMap decodeFieldsJson(const MessageSchema& schema,
+                                        const std::string& fieldsJson);
+
     mavsdk::MavlinkDirect::Result sendCmd(
         mavsdk::MavlinkDirect& mavlinkDirect,
         const mavsdk::System& system,
@@ -69,8 +142,16 @@ public:
 
 private:
     static bool isDefaultArdupilotDialectFile(const QString& xmlPath);
+    /// 是否可直接使用构建期生成的目录：文件名为 ardupilotmega.xml，且内容哈希
+    /// 与 DefaultDialectCatalog::SourceSha256 一致（文件不存在时视为一致）
+    static bool matchesDefaultCatalog(const QString& xmlPath);
+    void loadDefaultCatalog();
+    void compileMessages(const QByteArray& data);
+    void addMessage(MessageSchema schema);
 
     QMap<QString, ExternCmd> m_mapExternCMDs;
+    QMap<QString, std::shared_ptr<const MessageSchema>> m_messagesByName;
+    QHash<uint32_t, std::shared_ptr<const MessageSchema>> m_messagesById;
     std::string m_xmlContent;
     bool m_bCmdTableLoaded{false};
     bool m_needsMessageSetInject{false};
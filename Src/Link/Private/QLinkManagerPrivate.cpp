@@ -2,9 +2,31 @@
 #include "Link/QDataLink.h"
 #include "QGroundControlStation.h"
 #include "Private/QGroundControlStationPrivate.h"
+#include "Private/QGCSJournal.h"
+#include "Private/QGCSTrace.h"
 #include <QString>
 #include <QTimer>
 
+namespace {
+/// 按链路指定的每个系统 ID 各记一条，便于按飞机检索；未指定时记为系统 0
+void journalLinkEvent(QJournalEvent::Type type, const QDataLink *link,
+                      int64_t value = 0)
+{
+    if (!QGCSJournal::enabled()) {
+        return;
+    }
+    const int32_t kind = static_cast<int32_t>(link->linkKind());
+    const QList<int> systemIds = link->assignedSystemIds();
+    if (systemIds.isEmpty()) {
+        QGCSJournal::record(type, 0, kind, value);
+        return;
+    }
+    for (int systemId : systemIds) {
+        QGCSJournal::record(type, static_cast<uint8_t>(systemId), kind, value);
+    }
+}
+} // namespace
+
 QString QLinkManagerPrivate::buildConnectionString(LinkKind type, const LinkParams &params)
 {
     switch (type) {
@@ -82,6 +104,22 @@ QDataLink *QLinkManagerPrivate::addConnection(LinkKind type, const QString &conn
             }
         });
     }
+
+    /// 链路带宽、归属系统或开闭状态变化后重新分配遥测预算与流量归属
+    const QPointer<QGroundControlStation> station = m_groundStation;
+    const auto rebalance = [station]() {
+        if (station && station->d_ptr) {
+            station->d_ptr->refreshLinkTrafficRoutes(station);
+            station->d_ptr->scheduleTelemetryBudget(station);
+        }
+    };
+    QObject::connect(link, &QDataLink::bandwidthBytesPerSecondChanged,
+                     m_groundStation, rebalance);
+    QObject::connect(link, &QDataLink::assignedSystemIdsChanged,
+                     m_groundStation, rebalance);
+    QObject::connect(link, &QDataLink::openStatusChanged,
+                     m_groundStation, rebalance);
+    rebalance();
     return link;
 }
 
@@ -90,6 +128,7 @@ bool QLinkManagerPrivate::openConnection(QDataLink *link)
     if (!link || !m_groundStation || !m_groundStation->d_ptr) {
         return false;
     }
+    QGCS_TRACE_SCOPE("link", "openConnection");
     if (link->linkKind() == LinkKind::Raw) {
         return m_groundStation->d_ptr->addRawConnection(link);
     }
@@ -109,6 +148,10 @@ void QLinkManagerPrivate::removeConnection(const QString &connStr)
         if (link) {
             link->deleteLater();
         }
+        if (m_groundStation && m_groundStation->d_ptr) {
+            m_groundStation->d_ptr->refreshLinkTrafficRoutes(m_groundStation);
+            m_groundStation->d_ptr->scheduleTelemetryBudget(m_groundStation);
+        }
     }
 }
 
@@ -126,6 +169,18 @@ QStringList QLinkManagerPrivate::connectionStrings() const
     return m_connections.keys();
 }
 
+QList<QDataLink *> QLinkManagerPrivate::links() const
+{
+    QList<QDataLink *> result;
+    result.reserve(m_connections.size());
+    for (const QPointer<QDataLink> &link : m_connections) {
+        if (link) {
+            result.append(link.data());
+        }
+    }
+    return result;
+}
+
 void QLinkManagerPrivate::handleConnectionError(const QString &connStr,
                                                 const QString &reason)
 {
@@ -135,6 +190,7 @@ void QLinkManagerPrivate::handleConnectionError(const QString &connStr,
     }
 
     link->setOpened(false);
+    journalLinkEvent(QJournalEvent::LinkError, link);
     if (m_owner) {
         emit m_owner->linkConnectionError(link, reason);
     }
@@ -168,6 +224,8 @@ void QLinkManagerPrivate::scheduleReconnect(const QString &connStr,
     const int maxAttempts = link->reconnectCount();
     if (maxAttempts > 0 && nextAttempt > maxAttempts) {
         m_pendingReconnects.remove(connStr);
+        journalLinkEvent(QJournalEvent::LinkReconnectFailed, link,
+                         link->reconnectAttempts());
         emit m_owner->linkReconnectFailed(link, lastError);
         return;
     }
@@ -191,7 +249,10 @@ void QLinkManagerPrivate::scheduleReconnect(const QString &connStr,
             return;
         }
 
+        QGCS_TRACE_SCOPE_ID("link", "reconnect", link->reconnectAttempts());
         if (openConnection(link)) {
+            journalLinkEvent(QJournalEvent::LinkReconnected, link,
+                             link->reconnectAttempts());
             link->setReconnectAttempts(0);
             link->setOpened(true);
             m_pendingReconnects.remove(connStr);
@@ -29,6 +29,8 @@ public:
     void removeConnection(const QString &connStr);
     void removeLink(QDataLink *link);
     QStringList connectionStrings() const;
+    /** 当前管理的全部链路 */
+    QList<QDataLink *> links() const;
     void handleConnectionError(const QString &connStr, const QString &reason);
 
 private:
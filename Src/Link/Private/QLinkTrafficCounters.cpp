@@ -0,0 +1,115 @@
+#include "Link/Private/QLinkTrafficCounters.h"
+
+#include <chrono>
+#include <mavsdk/mavsdk.h>
+
+namespace {
+constexpr uint32_t SequenceValid = 1u << 24;
+
+int64_t nowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+/**
+ * @brief Raw 链路的 MAVLink 分帧状态
+ *
+ * 使用独立的 mavlink_status_t，不占用 MAVSDK 的通道状态。
+ */
+struct QLinkTrafficCounters::FrameParser
+{
+    mavlink_message_t rxMessage{};
+    mavlink_status_t rxStatus{};
+    mavlink_message_t message{};
+    mavlink_status_t status{};
+};
+
+QLinkTrafficCounters::QLinkTrafficCounters() = default;
+
+QLinkTrafficCounters::~QLinkTrafficCounters() = default;
+
+void QLinkTrafficCounters::recordReceivedPacket(uint8_t systemId,
+                                                uint8_t componentId,
+                                                uint8_t sequence,
+                                                std::size_t frameBytes)
+{
+    m_bytesReceived.fetch_add(frameBytes, std::memory_order_relaxed);
+    m_packetsReceived.fetch_add(1, std::memory_order_relaxed);
+    m_lastReceiveMs.store(nowMs(), std::memory_order_relaxed);
+    trackSequence(systemId, componentId, sequence);
+}
+
+void QLinkTrafficCounters::scanReceivedBytes(const char *data,
+                                             std::size_t length)
+{
+    if (!data || length == 0) {
+        return;
+    }
+    m_bytesReceived.fetch_add(length, std::memory_order_relaxed);
+    m_lastReceiveMs.store(nowMs(), std::memory_order_relaxed);
+
+    if (!m_parser) {
+        m_parser = std::make_unique<FrameParser>();
+    }
+    FrameParser &parser = *m_parser;
+    for (std::size_t index = 0; index < length; ++index) {
+        const uint8_t result = mavlink_frame_char_buffer(
+            &parser.rxMessage, &parser.rxStatus,
+            static_cast<uint8_t>(data[index]), &parser.message,
+            &parser.status);
+        if (result == MAVLINK_FRAMING_OK) {
+            m_packetsReceived.fetch_add(1, std::memory_order_relaxed);
+            trackSequence(parser.message.sysid, parser.message.compid,
+                          parser.message.seq);
+        } else if (result == MAVLINK_FRAMING_BAD_CRC) {
+            m_crcErrors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void QLinkTrafficCounters::trackSequence(uint8_t systemId,
+                                         uint8_t componentId,
+                                         uint8_t sequence)
+{
+    const uint32_t key = (static_cast<uint32_t>(systemId) << 8) | componentId;
+    const std::size_t slot = ((key * 40503u) >> 4) % SequenceSlots;
+    const uint32_t previous = m_sequences[slot].exchange(
+        SequenceValid | (key << 8) | sequence, std::memory_order_relaxed);
+    if (!(previous & SequenceValid) || ((previous >> 8) & 0xFFFFu) != key) {
+        return;
+    }
+    const uint8_t expected = static_cast<uint8_t>((previous & 0xFFu) + 1);
+    const uint8_t gap = static_cast<uint8_t>(sequence - expected);
+    if (gap != 0) {
+        m_packetsLost.fetch_add(gap, std::memory_order_relaxed);
+    }
+}
+
+QLinkTrafficCounters::Totals QLinkTrafficCounters::totals() const
+{
+    Totals totals;
+    totals.bytesReceived = m_bytesReceived.load(std::memory_order_relaxed);
+    totals.bytesSent = m_bytesSent.load(std::memory_order_relaxed);
+    totals.packetsReceived = m_packetsReceived.load(std::memory_order_relaxed);
+    totals.packetsSent = m_packetsSent.load(std::memory_order_relaxed);
+    totals.packetsLost = m_packetsLost.load(std::memory_order_relaxed);
+    totals.crcErrors = m_crcErrors.load(std::memory_order_relaxed);
+    totals.lastReceiveMs = m_lastReceiveMs.load(std::memory_order_relaxed);
+    return totals;
+}
+
+void QLinkTrafficCounters::reset()
+{
+    m_bytesReceived.store(0, std::memory_order_relaxed);
+    m_bytesSent.store(0, std::memory_order_relaxed);
+    m_packetsReceived.store(0, std::memory_order_relaxed);
+    m_packetsSent.store(0, std::memory_order_relaxed);
+    m_packetsLost.store(0, std::memory_order_relaxed);
+    m_crcErrors.store(0, std::memory_order_relaxed);
+    for (std::atomic<uint32_t> &sequence : m_sequences) {
+        sequence.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef QLINKTRAFFICCOUNTERS_H
+#define QLINKTRAFFICCOUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief 单条链路的收发计数
+ *
+ * 计数器全部为原子量，收发路径只做 relaxed 累加，不加锁、不分配；
+ * 链路线程按统计周期读取一次。收到的包按 (系统 ID, 组件 ID) 跟踪
+ * MAVLink 序号，序号跳变计入丢包。
+ */
+class QLinkTrafficCounters
+{
+public:
+    struct Totals
+    {
+        uint64_t bytesReceived{0};
+        uint64_t bytesSent{0};
+        uint64_t packetsReceived{0};
+        uint64_t packetsSent{0};
+        uint64_t packetsLost{0};
+        uint64_t crcErrors{0};
+        int64_t lastReceiveMs{0}; ///< 自纪元起毫秒，0 表示尚未收到
+    };
+
+    QLinkTrafficCounters();
+    ~QLinkTrafficCounters();
+
+    /**
+     * @brief 记录一个已校验的接收包（MAVSDK 接收线程）
+     * @param frameBytes 含帧头、校验与签名的线上字节数
+     */
+    void recordReceivedPacket(uint8_t systemId, uint8_t componentId,
+                              uint8_t sequence, std::size_t frameBytes);
+
+    /**
+     * @brief 解析 Raw 链路收到的原始字节：累计字节数、包数、CRC 错误与丢包
+     *
+     * 只在喂入 MAVSDK 的单个线程调用，不加锁；内部保留跨调用的半帧状态。
+     */
+    void scanReceivedBytes(const char *data, std::size_t length);
+
+    void recordSentPacket(std::size_t frameBytes)
+    {
+        m_bytesSent.fetch_add(frameBytes, std::memory_order_relaxed);
+        m_packetsSent.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Totals totals() const;
+    void reset();
+
+private:
+    struct FrameParser;
+
+    void trackSequence(uint8_t systemId, uint8_t componentId,
+                       uint8_t sequence);
+
+    /// 序号跟踪槽位数；(系统 ID, 组件 ID) 哈希冲突时重新开始跟踪
+    static constexpr std::size_t SequenceSlots = 512;
+
+    std::atomic<uint64_t> m_bytesReceived{0};
+    std::atomic<uint64_t> m_bytesSent{0};
+    std::atomic<uint64_t> m_packetsReceived{0};
+    std::atomic<uint64_t> m_packetsSent{0};
+    std::atomic<uint64_t> m_packetsLost{0};
+    std::atomic<uint64_t> m_crcErrors{0};
+    std::atomic<int64_t> m_lastReceiveMs{0};
+    /// 每槽：bit24 有效位 | 16 位 (系统 ID, 组件 ID) | 8 位上一个序号
+    std::array<std::atomic<uint32_t>, SequenceSlots> m_sequences{};
+
+    std::unique_ptr<FrameParser> m_parser; ///< Raw 链路半帧状态，首次使用时创建
+};
+
+#endif // QLINKTRAFFICCOUNTERS_H
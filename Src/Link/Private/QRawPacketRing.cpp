@@ -0,0 +1,150 @@
+#include "Link/Private/QRawPacketRing.h"
+#include <algorithm>
+#include <cstring>
+
+QRawPacketRing::QRawPacketRing(std::size_t capacity)
+    : m_storage(std::max<std::size_t>(capacity, 2 * HeaderSize))
+{
+}
+
+bool QRawPacketRing::push(const char *data, std::size_t length,
+                          bool *notify)
+{
+    if (notify) {
+        *notify = false;
+    }
+    if (!data || length == 0 || length >= WrapMarker) {
+        return false;
+    }
+
+    const std::size_t need = HeaderSize + length;
+    const std::size_t capacity = m_storage.size();
+    const std::size_t threshold = m_notifyThreshold.load();
+    bool crossed = false;
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_packets == 0) {
+            m_head = 0;
+            m_tail = 0;
+        }
+
+        std::size_t offset = 0;
+        bool fits = false;
+        if (m_packets == 0 || m_head > m_tail) {
+            /// 空闲区为 [head, capacity) 与 [0, tail)
+            if (capacity - m_head >= need) {
+                offset = m_head;
+                fits = true;
+            } else if (m_tail >= need) {
+                if (capacity - m_head >= HeaderSize) {
+                    writeHeader(m_head, WrapMarker);
+                }
+                offset = 0;
+                fits = true;
+            }
+        } else if (m_head < m_tail && m_tail - m_head >= need) {
+            /// 已回绕，空闲区为 [head, tail)
+            offset = m_head;
+            fits = true;
+        }
+
+        if (!fits) {
+            m_dropped.fetch_add(1);
+            return false;
+        }
+
+        writeHeader(offset, static_cast<std::uint32_t>(length));
+        std::memcpy(m_storage.data() + offset + HeaderSize, data, length);
+        m_head = offset + need;
+        ++m_packets;
+        m_bytes += length;
+        crossed = threshold > 0 && m_bytes >= threshold;
+    }
+    bool shouldNotify = !m_notifyPending.exchange(true);
+    if (!shouldNotify && crossed) {
+        shouldNotify = !m_thresholdNotified.exchange(true);
+    }
+    if (notify) {
+        *notify = shouldNotify;
+    }
+    return true;
+}
+
+std::size_t QRawPacketRing::drain(
+    const std::function<void(const char *, std::size_t)> &consumer,
+    std::size_t maxPackets)
+{
+    std::size_t count = 0;
+    std::size_t position = 0;
+    {
+        std::scoped_lock lock(m_mutex);
+        count = m_packets;
+        position = m_tail;
+    }
+    if (maxPackets != 0) {
+        count = std::min(count, maxPackets);
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    /// 读取区间在更新 tail 之前不会被生产者覆盖，回调期间无需持锁
+    const std::size_t capacity = m_storage.size();
+    std::size_t bytes = 0;
+    for (std::size_t index = 0; index < count; ++index) {
+        if (capacity - position < HeaderSize ||
+            readHeader(position) == WrapMarker) {
+            position = 0;
+        }
+        const std::size_t length = readHeader(position);
+        if (consumer) {
+            consumer(m_storage.data() + position + HeaderSize, length);
+        }
+        position += HeaderSize + length;
+        bytes += length;
+    }
+
+    std::scoped_lock lock(m_mutex);
+    m_tail = position;
+    m_packets -= count;
+    m_bytes -= bytes;
+    if (m_packets == 0) {
+        m_head = 0;
+        m_tail = 0;
+    }
+    return count;
+}
+
+std::size_t QRawPacketRing::pendingPackets() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_packets;
+}
+
+std::size_t QRawPacketRing::pendingBytes() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_bytes;
+}
+
+void QRawPacketRing::clear()
+{
+    std::scoped_lock lock(m_mutex);
+    m_head = 0;
+    m_tail = 0;
+    m_packets = 0;
+    m_bytes = 0;
+    clearNotify();
+}
+
+void QRawPacketRing::writeHeader(std::size_t offset, std::uint32_t value)
+{
+    std::memcpy(m_storage.data() + offset, &value, HeaderSize);
+}
+
+std::uint32_t QRawPacketRing::readHeader(std::size_t offset) const
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, m_storage.data() + offset, HeaderSize);
+    return value;
+}
@@ -0,0 +1,86 @@
+#ifndef QRAWPACKETRING_H
+#define QRAWPACKETRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Raw 链路的原始包环形缓冲区
+ *
+ * 预分配一段连续存储，按「长度 + 数据」成帧写入；记录不跨越缓冲区
+ * 末尾，读取方可以直接拿到指向存储区的只读视图。单生产者（MAVSDK
+ * 发送线程）与单消费者（链路所在线程）之间只在更新读写位置时加锁，
+ * 消费回调执行期间不持锁，生产者只会写入空闲区域。
+ */
+class QRawPacketRing
+{
+public:
+    static constexpr std::size_t DefaultCapacity = 256 * 1024;
+
+    explicit QRawPacketRing(std::size_t capacity = DefaultCapacity);
+
+    /**
+     * @brief 写入一个包（生产者线程）
+     * @param notify 输出：为 true 表示调用方需要通知消费者（本批次的第一个包）
+     * @return 是否写入；空间不足时丢弃该包并计数，不阻塞生产者
+     */
+    bool push(const char *data, std::size_t length, bool *notify = nullptr);
+
+    /**
+     * @brief 批量取出包（消费者线程）
+     * @param consumer 对每个包调用一次，视图仅在回调期间有效
+     * @param maxPackets 本次最多取出的包数，0 表示全部
+     * @return 取出的包数
+     */
+    std::size_t drain(
+        const std::function<void(const char *, std::size_t)> &consumer,
+        std::size_t maxPackets = 0);
+
+    /**
+     * @brief 取出后重新允许通知（消费者在处理前调用）
+     */
+    void clearNotify()
+    {
+        m_thresholdNotified.store(false);
+        m_notifyPending.store(false);
+    }
+
+    /**
+     * @brief 设置额外通知阈值
+     *
+     * 通知已发出但尚未取出时，累计字节数首次达到阈值会再通知一次，
+     * 用于按大小提前刷新；0 表示不启用。
+     */
+    void setNotifyThreshold(std::size_t bytes) { m_notifyThreshold.store(bytes); }
+
+    std::size_t pendingPackets() const;
+    std::size_t pendingBytes() const;
+    std::size_t capacity() const { return m_storage.size(); }
+    std::uint64_t droppedPackets() const { return m_dropped.load(); }
+
+    void clear();
+
+private:
+    static constexpr std::uint32_t WrapMarker = 0xFFFFFFFFu;
+    static constexpr std::size_t HeaderSize = sizeof(std::uint32_t);
+
+    void writeHeader(std::size_t offset, std::uint32_t value);
+    std::uint32_t readHeader(std::size_t offset) const;
+
+    std::vector<char> m_storage;
+    mutable std::mutex m_mutex;
+    std::size_t m_head{0};     ///< 下一次写入位置
+    std::size_t m_tail{0};     ///< 下一次读取位置
+    std::size_t m_packets{0};  ///< 未读取的包数
+    std::size_t m_bytes{0};    ///< 未读取的有效载荷字节数
+    std::atomic_bool m_notifyPending{false};
+    std::atomic_bool m_thresholdNotified{false};
+    std::atomic<std::size_t> m_notifyThreshold{0};
+    std::atomic<std::uint64_t> m_dropped{0};
+};
+
+#endif // QRAWPACKETRING_H
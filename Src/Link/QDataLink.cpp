@@ -1,11 +1,31 @@
 #include "Link/QDataLink.h"
+#include "Link/Private/QLinkTrafficCounters.h"
+#include "Link/Private/QRawPacketRing.h"
 #include "QGroundControlStation.h"
+#include <QMetaMethod>
+#include <QTimer>
 
 QDataLink::QDataLink(LinkKind kind, const QString &connStr, QObject *parent)
     : QObject(parent)
     , m_linkKind(kind)
     , m_connectionString(connStr)
+    , m_traffic(std::make_shared<QLinkTrafficCounters>())
 {
+    if (m_linkKind == LinkKind::Raw) {
+        m_rawRing = std::make_shared<QRawPacketRing>();
+    }
+    if (m_linkKind == LinkKind::Serial) {
+        /// serial://端口:波特率；8N1 每字节 10 位
+        const int baudRate =
+            m_connectionString.section(QLatin1Char(':'), -1).toInt();
+        m_bandwidthBytesPerSecond = qMax(0, baudRate / 10);
+    }
+
+    m_statsTimer = new QTimer(this);
+    connect(m_statsTimer, &QTimer::timeout,
+            this, &QDataLink::updateTrafficStats);
+    m_statsTimer->start(m_statsIntervalMs);
+    m_statsElapsed.start();
 }
 
 QDataLink::~QDataLink() = default;
@@ -27,6 +47,122 @@ void QDataLink::setAutoReconnect(bool enable)
     }
 }
 
+void QDataLink::setBandwidthBytesPerSecond(int bytesPerSecond)
+{
+    bytesPerSecond = qMax(0, bytesPerSecond);
+    if (m_bandwidthBytesPerSecond != bytesPerSecond) {
+        m_bandwidthBytesPerSecond = bytesPerSecond;
+        emit bandwidthBytesPerSecondChanged();
+    }
+}
+
+void QDataLink::setAssignedSystemIds(const QList<int> &systemIds)
+{
+    if (m_assignedSystemIds != systemIds) {
+        m_assignedSystemIds = systemIds;
+        emit assignedSystemIdsChanged();
+    }
+}
+
+void QDataLink::setStatsIntervalMs(int intervalMs)
+{
+    intervalMs = qMax(0, intervalMs);
+    if (m_statsIntervalMs == intervalMs) {
+        return;
+    }
+    m_statsIntervalMs = intervalMs;
+    if (intervalMs > 0) {
+        m_statsTimer->start(intervalMs);
+    } else {
+        m_statsTimer->stop();
+    }
+    emit statsIntervalMsChanged();
+}
+
+quint64 QDataLink::bytesReceived() const
+{
+    return m_traffic->totals().bytesReceived;
+}
+
+quint64 QDataLink::bytesSent() const
+{
+    return m_traffic->totals().bytesSent;
+}
+
+quint64 QDataLink::packetsReceived() const
+{
+    return m_traffic->totals().packetsReceived;
+}
+
+quint64 QDataLink::packetsSent() const
+{
+    return m_traffic->totals().packetsSent;
+}
+
+quint64 QDataLink::packetsLost() const
+{
+    return m_traffic->totals().packetsLost;
+}
+
+double QDataLink::lossPercent() const
+{
+    const QLinkTrafficCounters::Totals totals = m_traffic->totals();
+    const quint64 expected = totals.packetsReceived + totals.packetsLost;
+    return expected > 0 ? 100.0 * totals.packetsLost / expected : 0.0;
+}
+
+quint64 QDataLink::crcErrors() const
+{
+    return m_traffic->totals().crcErrors;
+}
+
+QDateTime QDataLink::lastReceiveTime() const
+{
+    const qint64 lastReceiveMs = m_traffic->totals().lastReceiveMs;
+    return lastReceiveMs > 0 ? QDateTime::fromMSecsSinceEpoch(lastReceiveMs)
+                             : QDateTime();
+}
+
+void QDataLink::resetTrafficStats()
+{
+    m_traffic->reset();
+    m_lastPacketsReceived = 0;
+    m_lastPacketsSent = 0;
+    m_lastStatsChecksum = 0;
+    m_receivePacketsPerSecond = 0.0;
+    m_sendPacketsPerSecond = 0.0;
+    m_statsElapsed.restart();
+    emit trafficStatsChanged();
+}
+
+void QDataLink::updateTrafficStats()
+{
+    const QLinkTrafficCounters::Totals totals = m_traffic->totals();
+    const double previousReceiveRate = m_receivePacketsPerSecond;
+    const double previousSendRate = m_sendPacketsPerSecond;
+    const qint64 elapsedMs = m_statsElapsed.restart();
+    if (elapsedMs > 0) {
+        m_receivePacketsPerSecond =
+            (totals.packetsReceived - m_lastPacketsReceived) * 1000.0 /
+            elapsedMs;
+        m_sendPacketsPerSecond =
+            (totals.packetsSent - m_lastPacketsSent) * 1000.0 / elapsedMs;
+    }
+    m_lastPacketsReceived = totals.packetsReceived;
+    m_lastPacketsSent = totals.packetsSent;
+
+    /// 计数只增不减，总和不变且速率未变时本周期无需通知
+    const quint64 checksum = totals.bytesReceived + totals.bytesSent +
+                             totals.packetsLost + totals.crcErrors;
+    if (checksum == m_lastStatsChecksum &&
+        m_receivePacketsPerSecond == previousReceiveRate &&
+        m_sendPacketsPerSecond == previousSendRate) {
+        return;
+    }
+    m_lastStatsChecksum = checksum;
+    emit trafficStatsChanged();
+}
+
 void QDataLink::setOpened(bool opened)
 {
     if (m_opened == opened) {
@@ -70,9 +206,144 @@ bool QDataLink::sendRawData(const QByteArray &data)
     return sendRawData(data.constData(), data.size());
 }
 
-void QDataLink::emitRawDataReceived(const QByteArray &data)
+int QDataLink::drainRawPackets(
+    const std::function<void(const char *data, int length)> &consumer,
+    int maxPackets)
+{
+    if (!m_rawRing) {
+        return 0;
+    }
+    const std::size_t drained = m_rawRing->drain(
+        [&consumer](const char *data, std::size_t length) {
+            if (consumer) {
+                consumer(data, static_cast<int>(length));
+            }
+        },
+        static_cast<std::size_t>(qMax(0, maxPackets)));
+    return static_cast<int>(drained);
+}
+
+int QDataLink::pendingRawPackets() const
+{
+    return m_rawRing ? static_cast<int>(m_rawRing->pendingPackets()) : 0;
+}
+
+quint64 QDataLink::droppedRawPackets() const
+{
+    return m_rawRing ? m_rawRing->droppedPackets() : 0;
+}
+
+void QDataLink::setRawFlushThresholdBytes(int bytes)
+{
+    bytes = qMax(0, bytes);
+    if (m_rawFlushThresholdBytes == bytes) {
+        return;
+    }
+    m_rawFlushThresholdBytes = bytes;
+    if (m_rawRing) {
+        m_rawRing->setNotifyThreshold(static_cast<std::size_t>(bytes));
+    }
+    emit rawFlushThresholdBytesChanged();
+}
+
+void QDataLink::setRawFlushLatencyMs(int latencyMs)
+{
+    latencyMs = qMax(0, latencyMs);
+    if (m_rawFlushLatencyMs == latencyMs) {
+        return;
+    }
+    m_rawFlushLatencyMs = latencyMs;
+    emit rawFlushLatencyMsChanged();
+}
+
+int QDataLink::drainRawData(
+    const std::function<void(const char *data, int length)> &consumer)
+{
+    if (!m_rawRing) {
+        return 0;
+    }
+
+    const qsizetype frameLimit = m_rawFlushThresholdBytes > 0
+        ? m_rawFlushThresholdBytes
+        : static_cast<qsizetype>(m_rawRing->pendingBytes());
+    if (m_rawFrame.capacity() < frameLimit) {
+        m_rawFrame.reserve(frameLimit);
+    }
+    m_rawFrame.resize(0);
+
+    int total = 0;
+    const auto emitFrame = [this, &consumer]() {
+        if (!m_rawFrame.isEmpty() && consumer) {
+            consumer(m_rawFrame.constData(),
+                     static_cast<int>(m_rawFrame.size()));
+        }
+        m_rawFrame.resize(0);
+    };
+    m_rawRing->drain([&](const char *data, std::size_t length) {
+        if (!m_rawFrame.isEmpty() &&
+            m_rawFrame.size() + static_cast<qsizetype>(length) > frameLimit) {
+            emitFrame();
+        }
+        m_rawFrame.append(data, static_cast<qsizetype>(length));
+        total += static_cast<int>(length);
+    });
+    emitFrame();
+    return total;
+}
+
+void QDataLink::handleRawDataReady()
 {
-    if (!data.isEmpty()) {
-        emit rawDataReceived(data);
+    if (!m_rawRing) {
+        return;
+    }
+
+    /// 设置了等待时间且未达到大小阈值时延后刷新；通知标记保持置位，
+    /// 期间的新包不会重复投递，只有越过大小阈值时会再通知一次
+    const bool belowThreshold = m_rawFlushThresholdBytes <= 0 ||
+        m_rawRing->pendingBytes() <
+            static_cast<std::size_t>(m_rawFlushThresholdBytes);
+    if (m_rawFlushLatencyMs > 0 && belowThreshold) {
+        if (!m_rawFlushTimer) {
+            m_rawFlushTimer = new QTimer(this);
+            m_rawFlushTimer->setSingleShot(true);
+            connect(m_rawFlushTimer, &QTimer::timeout,
+                    this, &QDataLink::flushRawData);
+        }
+        if (!m_rawFlushTimer->isActive()) {
+            m_rawFlushTimer->start(m_rawFlushLatencyMs);
+        }
+        return;
+    }
+    flushRawData();
+}
+
+void QDataLink::flushRawData()
+{
+    if (!m_rawRing) {
+        return;
+    }
+    if (m_rawFlushTimer) {
+        m_rawFlushTimer->stop();
+    }
+    /// 先允许下一批次通知，处理期间到达的包会再触发一次
+    m_rawRing->clearNotify();
+
+    static const QMetaMethod readySignal =
+        QMetaMethod::fromSignal(&QDataLink::rawDataReady);
+    static const QMetaMethod receivedSignal =
+        QMetaMethod::fromSignal(&QDataLink::rawDataReceived);
+    const bool hasReady = isSignalConnected(readySignal);
+    const bool hasReceived = isSignalConnected(receivedSignal);
+
+    if (hasReady) {
+        emit rawDataReady();
+    }
+    if (hasReceived) {
+        drainRawData([this](const char *data, int length) {
+            emit rawDataReceived(QByteArray(data, length));
+        });
+    } else if (!hasReady) {
+        /// 无人接收时直接丢弃，避免缓冲区被占满
+        m_rawRing->drain(nullptr);
     }
 }
@@ -4,13 +4,21 @@
 #include <mavsdk/plugins/action/action.h>
 #include <mavsdk/plugins/telemetry/telemetry.h>
 #include <mavsdk/plugins/mission/mission.h>
+#include <QPointer>
 #include <QVector>
+#include <atomic>
+#include <memory>
 #include <optional>
 #include <string>
 #include <cstdint>
 #include "Common/QGpsPosition.h"
 #include "AirLine/QMissionPoint.h"
 #include "QPlatPrivate.h"
+#include "Private/QGCSConfigInternal.h"
+#include "QAutopilotTelemetrySnapshot.h"
+#include "QCommandMetrics.h"
+
+class QAutopilot;
 
 /**
  * @brief QAutopilot的私有实现类
@@ -36,7 +44,47 @@ public:
     void setSystem(std::shared_ptr<mavsdk::System> system) override;
     void setupMessageHandling() override;
 
-    void setTelemetryRate();
+    /**
+     * @brief 向飞控请求遥测频率
+     * @param rates QGCSConfigInternal::TelemetryRate 位掩码，只发送对应的 set_rate_*
+     */
+    void setTelemetryRate(
+        uint32_t rates = QGCSConfigInternal::TelemetryRateAll);
+
+    /**
+     * @brief 仅在有接收者时订阅的遥测
+     */
+    static constexpr uint32_t DemandDrivenRates =
+        QGCSConfigInternal::TelemetryRateAttitude |
+        QGCSConfigInternal::TelemetryRateRawGps |
+        QGCSConfigInternal::TelemetryRateHome |
+        QGCSConfigInternal::TelemetryRateFixedwingMetrics;
+
+    /**
+     * @brief 无接收者时可请求飞控停发的遥测
+     *
+     * GPS_RAW_INT 同时提供 gps_info，HOME_POSITION 决定健康状态中的
+     * home 标志，这两项只取消订阅、不停发。
+     */
+    static constexpr uint32_t StoppableRates =
+        QGCSConfigInternal::TelemetryRateAttitude |
+        QGCSConfigInternal::TelemetryRateFixedwingMetrics;
+
+    /**
+     * @brief 按接收者变化增减按需遥测的订阅与消息频率
+     */
+    void setObservedTelemetryRates(uint32_t rates);
+
+    /**
+     * @brief 按当前配置频率、档位与接收者估算的遥测下行字节率（不含预算缩放）
+     */
+    double telemetryDemandBytesPerSecond() const;
+
+    /**
+     * @brief 设置链路带宽预算分配到的频率缩放系数
+     * @return 与当前系数差异明显、需要重新下发频率时返回 true
+     */
+    bool setTelemetryBudgetScale(double scale);
 
     void downloadAirLine(quint64 requestId);
     void uploadAirLine(quint64 requestId,
@@ -52,20 +100,47 @@ public:
                            quint32 componentId,
                            const QVector<float> &params);
 
+    /**
+     * @brief 将快照中的脏遥测字段合并应用到 QAutopilot（拥有者线程）
+     */
+    static void flushTelemetrySnapshot(
+        const QPointer<QAutopilot> &autopilot,
+        const std::shared_ptr<QAutopilotTelemetrySnapshot> &snapshot);
+
+    /**
+     * @brief 将一次命令的结果计入 QAutopilot 的命令统计（拥有者线程）
+     */
+    static void recordCommandResult(QAutopilot *autopilot,
+                                    const QCommandAttempt &attempt,
+                                    QCommandMetrics::Outcome outcome);
+
 protected:
     void clearTelemetrySubscriptions();
+    void subscribeDemandTelemetry(uint32_t rates);
+    void unsubscribeDemandTelemetry(uint32_t rates);
     void clearMissionSubscription();
     void clearExternalCommandSubscription();
     void setupExternalCommandSubscription();
-    void handleExternalCommandAck(
-        uint32_t sourceComponentId, const std::string &fieldsJson);
+    void handleExternalCommandAck(uint32_t sourceComponentId,
+                                  uint16_t commandId, uint8_t mavResult,
+                                  int64_t ackUs);
+    /**
+     * @brief 清除等待中的扩展命令，并让接收线程不再转发其 COMMAND_ACK
+     */
+    void clearPendingExternalCommand();
     void scheduleExternalCommandTimeout(quint64 generation);
 
+    /**
+     * @brief 开始计时一次命令并计入发送次数
+     */
+    QCommandAttempt beginCommand(const QString &name, uint16_t mavCommand);
+
     struct PendingExternalCommand {
         QString name;
         int commandId{};
         uint32_t componentId{};
         quint64 generation{};
+        QCommandAttempt attempt;
     };
 
     /**
@@ -78,6 +153,9 @@ protected:
     std::unique_ptr<mavsdk::Telemetry> m_telemetry; ///< 遥测插件
     std::unique_ptr<mavsdk::Action>    m_action;
     std::unique_ptr<mavsdk::Mission>   m_mission; /// 任务
+    std::shared_ptr<QAutopilotTelemetrySnapshot> m_telemetrySnapshot; ///< 高频遥测最新值
+    uint32_t m_observedRates{0}; ///< 有接收者的按需遥测位
+    double m_budgetScale{1.0}; ///< 链路带宽预算分配的频率缩放
 
     mavsdk::Telemetry::PositionHandle m_positionHandle;
     mavsdk::Telemetry::HeadingHandle m_headingHandle;
@@ -96,8 +174,11 @@ protected:
     mavsdk::Telemetry::RcStatusHandle m_rcStatusHandle;
     mavsdk::Telemetry::FixedwingMetricsHandle m_fixedwingMetricsHandle;
     mavsdk::Mission::MissionProgressHandle m_missionProgressHandle;
-    mavsdk::MavlinkDirect::MessageHandle m_commandAckHandle;
+    mavsdk::MavlinkPassthrough::MessageHandle m_commandAckHandle;
     std::optional<PendingExternalCommand> m_pendingExternalCommand;
+    /// 等待中扩展命令的 COMMAND_ACK 过滤键，接收线程据此丢弃无关应答；0 表示无
+    std::shared_ptr<std::atomic<uint32_t>> m_externalAckFilter{
+        std::make_shared<std::atomic<uint32_t>>(0)};
     quint64 m_externalCommandGeneration{};
 };
 
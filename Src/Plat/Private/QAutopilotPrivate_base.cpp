@@ -2,17 +2,23 @@
 #include "Plat/Private/QAutopilotPrivate.h"
 #include <QPointer>
 #include <QCoreApplication>
-#include <QJsonDocument>
-#include <QJsonObject>
 #include <QTimer>
+#include <algorithm>
 #include <sstream>
 
 #include "Extern/XmlToMavSDK.h"
 #include "QGCSConfig.h"
+#include "QGroundControlStation.h"
+#include "Private/QGroundControlStationPrivate.h"
 #include "Private/QGCSConfigInternal.h"
+#include "Private/QGCSJournal.h"
 #include "Private/QGCSLog.h"
+#include "Private/QGCSTrace.h"
 #include "Private/QMavsdkTextCatalog.h"
+#include "Private/QQueuedInvoke.h"
 #include "Plat/Private/QMavsdkTypeMap.h"
+#include "Plat/Private/QTelemetryBudget.h"
+#include "Plat/Private/QTelemetryWorkerPool.h"
 
 template<>struct fmt::formatter<mavsdk::Action::Result>:ostream_formatter{};
 
@@ -33,32 +39,102 @@ bool hasFixedWingMetrics(QAutoVehicleType::Vehicle vehicle)
     }
 }
 
+QCommandMetrics::Outcome actionOutcome(mavsdk::Action::Result result)
+{
+    switch (result) {
+    case mavsdk::Action::Result::Success:
+        return QCommandMetrics::Outcome::Accepted;
+    case mavsdk::Action::Result::Timeout:
+        return QCommandMetrics::Outcome::TimedOut;
+    case mavsdk::Action::Result::Unknown:
+    case mavsdk::Action::Result::NoSystem:
+    case mavsdk::Action::Result::ConnectionError:
+    case mavsdk::Action::Result::InvalidArgument:
+        return QCommandMetrics::Outcome::Failed;
+    default:
+        return QCommandMetrics::Outcome::Rejected;
+    }
+}
+
+QJournalEvent::Type journalType(QCommandMetrics::Outcome outcome)
+{
+    switch (outcome) {
+    case QCommandMetrics::Outcome::Accepted:
+        return QJournalEvent::CommandAccepted;
+    case QCommandMetrics::Outcome::Rejected:
+        return QJournalEvent::CommandRejected;
+    case QCommandMetrics::Outcome::TimedOut:
+        return QJournalEvent::CommandTimedOut;
+    case QCommandMetrics::Outcome::Failed:
+        break;
+    }
+    return QJournalEvent::CommandFailed;
+}
+
+/// COMMAND_ACK 过滤键：有效位 | 目标组件（0 为任意）<< 16 | MAV_CMD
+uint32_t externalAckFilterKey(uint32_t componentId, uint32_t commandId)
+{
+    return 0x80000000u | ((componentId & 0xFFu) << 16) | (commandId & 0xFFFFu);
+}
+
+bool externalAckMatches(uint32_t filter, uint8_t sourceComponentId,
+                        uint16_t commandId)
+{
+    const uint32_t componentId = (filter >> 16) & 0xFFu;
+    return (filter & 0xFFFFu) == commandId &&
+           (componentId == 0 || componentId == sourceComponentId);
+}
+
 void dispatchActionResult(
     const QPointer<QAutopilot> &autopilot,
     QAutopilot::ActionCommand command,
     mavsdk::Action::Result result,
-    uint8_t systemId,
-    const char *operation)
+    QCommandAttempt attempt)
 {
+    attempt.finish();
     if (result != mavsdk::Action::Result::Success) {
-        spdlog::error(PLAT_FMT_STR, systemId, operation, result);
+        spdlog::error(PLAT_FMT_STR, attempt.systemId,
+                      attempt.name.toUtf8().constData(), result);
     }
     if (!autopilot) {
         return;
     }
     QMetaObject::invokeMethod(
         autopilot,
-        [autopilot, command, result]() {
+        [autopilot, command, result, attempt = std::move(attempt)]() {
             if (!autopilot) {
                 return;
             }
+            QAutopilotPrivate::recordCommandResult(
+                autopilot, attempt, actionOutcome(result));
             const QString reason = QMavsdkTextCatalog::text(
-                QStringLiteral("actionResult"), static_cast<int>(result));
+                QMavsdkTextCatalog::ActionResult, static_cast<int>(result));
             emit autopilot->actionCommandFinished(
                 command, result == mavsdk::Action::Result::Success, reason);
         },
         Qt::QueuedConnection);
 }
+
+void publishTelemetry(
+    const QPointer<QAutopilot> &autopilot,
+    const std::shared_ptr<QAutopilotTelemetrySnapshot> &snapshot,
+    quint32 stream)
+{
+    if (!autopilot || !snapshot->active) {
+        return;
+    }
+    snapshot->stampSample(stream);
+    if (!snapshot->markDirty(stream)) {
+        return;
+    }
+    QObject *context = snapshot->worker ? snapshot->worker : autopilot.data();
+    QMetaObject::invokeMethod(
+        context,
+        [autopilot, snapshot]() {
+            QAutopilotPrivate::flushTelemetrySnapshot(autopilot, snapshot);
+        },
+        Qt::QueuedConnection);
+}
 } // namespace
 
 QAutopilotPrivate::QAutopilotPrivate(QPlat *pPlat)
@@ -67,6 +143,9 @@ QAutopilotPrivate::QAutopilotPrivate(QPlat *pPlat)
 
 QAutopilotPrivate::~QAutopilotPrivate()
 {
+    if (m_telemetrySnapshot) {
+        m_telemetrySnapshot->active = false;
+    }
     if (m_mission) {
         m_mission->cancel_mission_download();
         m_mission->cancel_mission_upload();
@@ -99,6 +178,11 @@ void QAutopilotPrivate::setSystem(std::shared_ptr<mavsdk::System> system) {
     clearMissionSubscription();
     clearExternalCommandSubscription();
     clearTelemetrySubscriptions();
+    q_func()->m_commandMetrics->clearInFlight();
+    if (m_telemetrySnapshot) {
+        m_telemetrySnapshot->active = false;
+        m_telemetrySnapshot.reset();
+    }
     m_mission.reset();
     m_action.reset();
     m_telemetry.reset();
@@ -111,24 +195,19 @@ void QAutopilotPrivate::setSystem(std::shared_ptr<mavsdk::System> system) {
         return;
     }
 
-    m_telemetry = std::make_unique<mavsdk::Telemetry>(*system);
-    m_action = std::make_unique<mavsdk::Action>(*system);
-    m_mission = std::make_unique<mavsdk::Mission>(*system);
+    {
+        QGCS_TRACE_SCOPE_ID("plugin", "constructAutopilotPlugins",
+                            system->get_system_id());
+        m_telemetry = std::make_unique<mavsdk::Telemetry>(*system);
+        m_action = std::make_unique<mavsdk::Action>(*system);
+        m_mission = std::make_unique<mavsdk::Mission>(*system);
+    }
     const QPointer<QAutopilot> autopilot(q_func());
     m_missionProgressHandle = m_mission->subscribe_mission_progress(
         [autopilot](mavsdk::Mission::MissionProgress progress) {
-            if (!autopilot) {
-                return;
-            }
-            QMetaObject::invokeMethod(
-                autopilot,
-                [autopilot, progress]() {
-                    if (autopilot) {
-                        autopilot->missionProgressUpdate(
-                            progress.current, progress.total);
-                    }
-                },
-                Qt::QueuedConnection);
+            QQueuedInvoke::post(autopilot, &QAutopilot::missionProgressUpdate,
+                                static_cast<int>(progress.current),
+                                static_cast<int>(progress.total));
         });
     setupExternalCommandSubscription();
 
@@ -144,12 +223,14 @@ void QAutopilotPrivate::arm() {
     if (!m_action || !m_pSystem) {
         return;
     }
-    const uint8_t systemId = m_pSystem->get_system_id();
     const QPointer<QAutopilot> autopilot(q_func());
-    m_action->arm_async([autopilot, systemId](mavsdk::Action::Result result) {
-        dispatchActionResult(autopilot, QAutopilot::ArmAction,
-                             result, systemId, "arm");
-    });
+    m_action->arm_async(
+        [autopilot, attempt = beginCommand(QStringLiteral("arm"),
+                                           MAV_CMD_COMPONENT_ARM_DISARM)](
+            mavsdk::Action::Result result) {
+            dispatchActionResult(autopilot, QAutopilot::ArmAction, result,
+                                 attempt);
+        });
 }
 
 void QAutopilotPrivate::clearTelemetrySubscriptions()
@@ -158,6 +239,8 @@ void QAutopilotPrivate::clearTelemetrySubscriptions()
         return;
     }
 
+    unsubscribeDemandTelemetry(DemandDrivenRates);
+
     if (m_positionHandle.valid()) {
         m_telemetry->unsubscribe_position(m_positionHandle);
         m_positionHandle = {};
@@ -170,14 +253,6 @@ void QAutopilotPrivate::clearTelemetrySubscriptions()
         m_telemetry->unsubscribe_battery(m_batteryHandle);
         m_batteryHandle = {};
     }
-    if (m_rawGpsHandle.valid()) {
-        m_telemetry->unsubscribe_raw_gps(m_rawGpsHandle);
-        m_rawGpsHandle = {};
-    }
-    if (m_attitudeEulerHandle.valid()) {
-        m_telemetry->unsubscribe_attitude_euler(m_attitudeEulerHandle);
-        m_attitudeEulerHandle = {};
-    }
     if (m_flightModeHandle.valid()) {
         m_telemetry->unsubscribe_flight_mode(m_flightModeHandle);
         m_flightModeHandle = {};
@@ -211,21 +286,118 @@ void QAutopilotPrivate::clearTelemetrySubscriptions()
         m_telemetry->unsubscribe_distance_sensor(m_distanceSensorHandle);
         m_distanceSensorHandle = {};
     }
-    if (m_homeHandle.valid()) {
-        m_telemetry->unsubscribe_home(m_homeHandle);
-        m_homeHandle = {};
-    }
     if (m_rcStatusHandle.valid()) {
         m_telemetry->unsubscribe_rc_status(m_rcStatusHandle);
         m_rcStatusHandle = {};
     }
-    if (m_fixedwingMetricsHandle.valid()) {
+}
+
+void QAutopilotPrivate::unsubscribeDemandTelemetry(uint32_t rates)
+{
+    if (!m_telemetry) {
+        return;
+    }
+
+    if ((rates & QGCSConfigInternal::TelemetryRateAttitude) &&
+        m_attitudeEulerHandle.valid()) {
+        m_telemetry->unsubscribe_attitude_euler(m_attitudeEulerHandle);
+        m_attitudeEulerHandle = {};
+    }
+    if ((rates & QGCSConfigInternal::TelemetryRateRawGps) &&
+        m_rawGpsHandle.valid()) {
+        m_telemetry->unsubscribe_raw_gps(m_rawGpsHandle);
+        m_rawGpsHandle = {};
+    }
+    if ((rates & QGCSConfigInternal::TelemetryRateHome) &&
+        m_homeHandle.valid()) {
+        m_telemetry->unsubscribe_home(m_homeHandle);
+        m_homeHandle = {};
+    }
+    if ((rates & QGCSConfigInternal::TelemetryRateFixedwingMetrics) &&
+        m_fixedwingMetricsHandle.valid()) {
         m_telemetry->unsubscribe_fixedwing_metrics(
             m_fixedwingMetricsHandle);
         m_fixedwingMetricsHandle = {};
     }
 }
 
+void QAutopilotPrivate::subscribeDemandTelemetry(uint32_t rates)
+{
+    if (!m_telemetry || !m_telemetrySnapshot) {
+        return;
+    }
+    const QPointer<QAutopilot> autopilot(q_func());
+    const auto snapshot = m_telemetrySnapshot;
+
+    if ((rates & QGCSConfigInternal::TelemetryRateAttitude) &&
+        !m_attitudeEulerHandle.valid()) {
+        m_attitudeEulerHandle = m_telemetry->subscribe_attitude_euler(
+            [autopilot, snapshot](mavsdk::Telemetry::EulerAngle attitude) {
+                snapshot->attitude.store(attitude);
+                publishTelemetry(autopilot, snapshot, TelemetryAttitude);
+            });
+    }
+
+    if ((rates & QGCSConfigInternal::TelemetryRateRawGps) &&
+        !m_rawGpsHandle.valid()) {
+        m_rawGpsHandle = m_telemetry->subscribe_raw_gps(
+            [autopilot, snapshot](mavsdk::Telemetry::RawGps gps) {
+                snapshot->rawGps.store(gps);
+                publishTelemetry(autopilot, snapshot, TelemetryRawGps);
+            });
+    }
+
+    /// 订阅home点
+    if ((rates & QGCSConfigInternal::TelemetryRateHome) &&
+        !m_homeHandle.valid()) {
+        m_homeHandle = m_telemetry->subscribe_home(
+            [autopilot, snapshot](mavsdk::Telemetry::Position home) {
+                snapshot->home.store(home);
+                publishTelemetry(autopilot, snapshot, TelemetryHome);
+            });
+    }
+
+    if ((rates & QGCSConfigInternal::TelemetryRateFixedwingMetrics) &&
+        !m_fixedwingMetricsHandle.valid() &&
+        hasFixedWingMetrics(q_func()->vehicleType())) {
+        m_fixedwingMetricsHandle = m_telemetry->subscribe_fixedwing_metrics(
+            [autopilot, snapshot](mavsdk::Telemetry::FixedwingMetrics metrics) {
+                snapshot->fixedwingMetrics.store(metrics);
+                publishTelemetry(autopilot, snapshot,
+                                 TelemetryFixedwingMetrics);
+            });
+    }
+}
+
+void QAutopilotPrivate::setObservedTelemetryRates(uint32_t rates)
+{
+    rates &= DemandDrivenRates;
+    const uint32_t added = rates & ~m_observedRates;
+    const uint32_t removed = m_observedRates & ~rates;
+    m_observedRates = rates;
+    if (!added && !removed) {
+        return;
+    }
+    if (m_pSystem) {
+        spdlog::debug(PLAT_FMT_STR, m_pSystem->get_system_id(),
+                      "observed telemetry", rates);
+    }
+
+    /// 尚未建立订阅时由 setupMessageHandling 按当前接收者统一处理
+    if (!m_telemetrySnapshot) {
+        return;
+    }
+    unsubscribeDemandTelemetry(removed);
+    subscribeDemandTelemetry(added);
+    setTelemetryRate(added | removed);
+
+    /// 按需订阅改变了本机的带宽需求，链路预算需重新分配
+    auto *station = qobject_cast<QGroundControlStation *>(q_func()->parent());
+    if (station && station->d_ptr) {
+        station->d_ptr->scheduleTelemetryBudget(station);
+    }
+}
+
 void QAutopilotPrivate::clearMissionSubscription()
 {
     if (!m_mission || !m_missionProgressHandle.valid()) {
@@ -241,12 +413,14 @@ void QAutopilotPrivate::disarm()
     if (!m_action || !m_pSystem) {
         return;
     }
-    const uint8_t systemId = m_pSystem->get_system_id();
     const QPointer<QAutopilot> autopilot(q_func());
-    m_action->disarm_async([autopilot, systemId](mavsdk::Action::Result result) {
-        dispatchActionResult(autopilot, QAutopilot::DisarmAction,
-                             result, systemId, "disarm");
-    });
+    m_action->disarm_async(
+        [autopilot, attempt = beginCommand(QStringLiteral("disarm"),
+                                           MAV_CMD_COMPONENT_ARM_DISARM)](
+            mavsdk::Action::Result result) {
+            dispatchActionResult(autopilot, QAutopilot::DisarmAction, result,
+                                 attempt);
+        });
 }
 
 void QAutopilotPrivate::takeoff()
@@ -254,12 +428,14 @@ void QAutopilotPrivate::takeoff()
     if (!m_action || !m_pSystem) {
         return;
     }
-    const uint8_t systemId = m_pSystem->get_system_id();
     const QPointer<QAutopilot> autopilot(q_func());
-    m_action->takeoff_async([autopilot, systemId](mavsdk::Action::Result result) {
-        dispatchActionResult(autopilot, QAutopilot::TakeoffAction,
-                             result, systemId, "takeoff");
-    });
+    m_action->takeoff_async(
+        [autopilot, attempt = beginCommand(QStringLiteral("takeoff"),
+                                           MAV_CMD_NAV_TAKEOFF)](
+            mavsdk::Action::Result result) {
+            dispatchActionResult(autopilot, QAutopilot::TakeoffAction, result,
+                                 attempt);
+        });
 }
 
 void QAutopilotPrivate::land()
@@ -267,12 +443,14 @@ void QAutopilotPrivate::land()
     if (!m_action || !m_pSystem) {
         return;
     }
-    const uint8_t systemId = m_pSystem->get_system_id();
     const QPointer<QAutopilot> autopilot(q_func());
-    m_action->land_async([autopilot, systemId](mavsdk::Action::Result result) {
-        dispatchActionResult(autopilot, QAutopilot::LandAction,
-                             result, systemId, "land");
-    });
+    m_action->land_async(
+        [autopilot, attempt = beginCommand(QStringLiteral("land"),
+                                           MAV_CMD_NAV_LAND)](
+            mavsdk::Action::Result result) {
+            dispatchActionResult(autopilot, QAutopilot::LandAction, result,
+                                 attempt);
+        });
 }
 
 void QAutopilotPrivate::returnToLaunch()
@@ -280,64 +458,110 @@ void QAutopilotPrivate::returnToLaunch()
     if (!m_action || !m_pSystem) {
         return;
     }
-    const uint8_t systemId = m_pSystem->get_system_id();
     const QPointer<QAutopilot> autopilot(q_func());
+    /// MAVSDK 以切换 RTL 飞行模式实现返航，重发按 DO_SET_MODE 统计
     m_action->return_to_launch_async(
-        [autopilot, systemId](mavsdk::Action::Result result) {
+        [autopilot, attempt = beginCommand(QStringLiteral("return_to_launch"),
+                                           MAV_CMD_DO_SET_MODE)](
+            mavsdk::Action::Result result) {
             dispatchActionResult(autopilot, QAutopilot::ReturnToLaunchAction,
-                                 result, systemId, "return_to_launch");
+                                 result, attempt);
         });
 }
 
+QCommandAttempt QAutopilotPrivate::beginCommand(const QString &name,
+                                                uint16_t mavCommand)
+{
+    QCommandAttempt attempt = QCommandAttempt::begin(
+        name, mavCommand, m_pSystem->get_system_id(), m_messageStats);
+    q_func()->m_commandMetrics->recordSent(attempt);
+    return attempt;
+}
+
+void QAutopilotPrivate::recordCommandResult(QAutopilot *autopilot,
+                                            const QCommandAttempt &attempt,
+                                            QCommandMetrics::Outcome outcome)
+{
+    if (autopilot) {
+        autopilot->m_commandMetrics->recordFinished(attempt, outcome);
+    }
+    QGCSJournal::record(journalType(outcome), attempt.systemId,
+                        attempt.mavCommand, attempt.latencyUs);
+}
+
 template<>struct fmt::formatter<mavsdk::MavlinkDirect::Result>:ostream_formatter{};
 
 void QAutopilotPrivate::clearExternalCommandSubscription()
 {
-    if (m_pMavlinkDirect && m_commandAckHandle.valid()) {
-        m_pMavlinkDirect->unsubscribe_message(m_commandAckHandle);
+    if (m_pMavlinkPassthrough && m_commandAckHandle.valid()) {
+        m_pMavlinkPassthrough->unsubscribe_message(MAVLINK_MSG_ID_COMMAND_ACK,
+                                                   m_commandAckHandle);
         m_commandAckHandle = {};
     }
+    clearPendingExternalCommand();
+}
+
+void QAutopilotPrivate::clearPendingExternalCommand()
+{
     m_pendingExternalCommand.reset();
     ++m_externalCommandGeneration;
+    m_externalAckFilter->store(0, std::memory_order_release);
 }
 
 void QAutopilotPrivate::setupExternalCommandSubscription()
 {
-    if (!m_pMavlinkDirect || !m_pSystem) {
+    if (!m_pMavlinkPassthrough || !m_pSystem) {
         return;
     }
 
     const QPointer<QAutopilot> autopilot(q_func());
     const std::weak_ptr<mavsdk::System> weakSystem(m_pSystem);
-    m_commandAckHandle = m_pMavlinkDirect->subscribe_message(
-        "COMMAND_ACK",
-        [autopilot, weakSystem](mavsdk::MavlinkDirect::MavlinkMessage message) {
-            if (!autopilot) {
+    const std::shared_ptr<std::atomic<uint32_t>> ackFilter =
+        m_externalAckFilter;
+    const uint8_t stationId = QGCSConfig::instance()->stationId();
+    m_commandAckHandle = m_pMavlinkPassthrough->subscribe_message(
+        MAVLINK_MSG_ID_COMMAND_ACK,
+        [autopilot, weakSystem, ackFilter,
+         stationId](const mavlink_message_t &message) {
+            /// MAVSDK 自身动作的应答与发给其他地面站的应答不跨线程
+            const uint32_t filter = ackFilter->load(std::memory_order_acquire);
+            if (!filter || !autopilot) {
                 return;
             }
-            const uint32_t sourceComponentId = message.component_id;
-            std::string fieldsJson = std::move(message.fields_json);
+            mavlink_command_ack_t ack;
+            mavlink_msg_command_ack_decode(&message, &ack);
+            if (!externalAckMatches(filter, message.compid, ack.command) ||
+                (ack.target_system != 0 && ack.target_system != stationId)) {
+                return;
+            }
+            const int64_t ackUs = QCommandAttempt::nowUs();
+            const uint32_t sourceComponentId = message.compid;
+            const uint16_t commandId = ack.command;
+            const uint8_t mavResult = ack.result;
             QMetaObject::invokeMethod(
                 autopilot,
-                [autopilot, weakSystem,
-                 sourceComponentId,
-                 fieldsJson = std::move(fieldsJson)]() {
+                [autopilot, weakSystem, ackUs, sourceComponentId, commandId,
+                 mavResult]() {
                     const auto system = weakSystem.lock();
                     if (!autopilot || !system || !autopilot->d_func() ||
                         autopilot->d_func()->getSystem() != system) {
                         return;
                     }
                     autopilot->d_func()->handleExternalCommandAck(
-                        sourceComponentId, fieldsJson);
+                        sourceComponentId, commandId, mavResult, ackUs);
                 },
                 Qt::QueuedConnection);
         });
 }
 
-void QAutopilotPrivate::handleExternalCommandAck(
-    uint32_t sourceComponentId, const std::string &fieldsJson)
+void QAutopilotPrivate::handleExternalCommandAck(uint32_t sourceComponentId,
+                                                 uint16_t commandId,
+                                                 uint8_t mavResult,
+                                                 int64_t ackUs)
 {
-    if (!m_pendingExternalCommand) {
+    /// 接收线程已按过滤键筛过；过滤键更新前发出的投递在此再核对一次
+    if (!m_pendingExternalCommand ||
+        commandId != m_pendingExternalCommand->commandId) {
         return;
     }
     if (m_pendingExternalCommand->componentId != 0 &&
@@ -345,20 +569,6 @@ void QAutopilotPrivate::handleExternalCommandAck(
         return;
     }
 
-    QJsonParseError error;
-    const QJsonDocument document = QJsonDocument::fromJson(
-        QByteArray::fromStdString(fieldsJson), &error);
-    if (error.error != QJsonParseError::NoError || !document.isObject()) {
-        return;
-    }
-
-    const QJsonObject object = document.object();
-    const int commandId = object.value(QStringLiteral("command")).toInt(-1);
-    if (commandId != m_pendingExternalCommand->commandId) {
-        return;
-    }
-
-    const int mavResult = object.value(QStringLiteral("result")).toInt(-1);
     if (mavResult == MAV_RESULT_IN_PROGRESS) {
         const quint64 generation = ++m_externalCommandGeneration;
         m_pendingExternalCommand->generation = generation;
@@ -367,11 +577,15 @@ void QAutopilotPrivate::handleExternalCommandAck(
     }
 
     const QString name = m_pendingExternalCommand->name;
-    m_pendingExternalCommand.reset();
-    ++m_externalCommandGeneration;
+    QCommandAttempt attempt = std::move(m_pendingExternalCommand->attempt);
+    clearPendingExternalCommand();
     const bool success = mavResult == MAV_RESULT_ACCEPTED;
+    attempt.finish(ackUs);
+    recordCommandResult(q_func(), attempt,
+                        success ? QCommandMetrics::Outcome::Accepted
+                                : QCommandMetrics::Outcome::Rejected);
     const QString reason = QMavsdkTextCatalog::text(
-        QStringLiteral("commandAckResult"), mavResult);
+        QMavsdkTextCatalog::CommandAckResult, mavResult);
     if (success) {
         spdlog::info(PLAT_FMT_STR, m_pSystem->get_system_id(),
                      "externCommand", name.toUtf8().constData());
@@ -401,8 +615,12 @@ void QAutopilotPrivate::scheduleExternalCommandTimeout(quint64 generation)
             }
             const QString name =
                 implementation->m_pendingExternalCommand->name;
-            implementation->m_pendingExternalCommand.reset();
-            ++implementation->m_externalCommandGeneration;
+            QCommandAttempt attempt =
+                std::move(implementation->m_pendingExternalCommand->attempt);
+            implementation->clearPendingExternalCommand();
+            attempt.finish();
+            recordCommandResult(autopilot, attempt,
+                                QCommandMetrics::Outcome::TimedOut);
             spdlog::warn(PLAT_FMT_STR, autopilot->vehicleId(),
                          "externCommandTimeout",
                          name.toUtf8().constData());
@@ -443,13 +661,18 @@ bool QAutopilotPrivate::sendExternCommand(const QString &name,
 
     const quint64 generation = ++m_externalCommandGeneration;
     m_pendingExternalCommand = PendingExternalCommand{
-        name, static_cast<int>(command->value), componentId, generation};
+        name, static_cast<int>(command->value), componentId, generation,
+        beginCommand(name, command->value)};
+    m_externalAckFilter->store(
+        externalAckFilterKey(componentId, command->value),
+        std::memory_order_release);
 
     const auto result = m_xmlExtension->sendCmd(
         *m_pMavlinkDirect, *m_pSystem, name, componentId, params);
     if (mavsdk::MavlinkDirect::Result::Success != result) {
-        m_pendingExternalCommand.reset();
-        ++m_externalCommandGeneration;
+        recordCommandResult(q_func(), m_pendingExternalCommand->attempt,
+                            QCommandMetrics::Outcome::Failed);
+        clearPendingExternalCommand();
         spdlog::error(PLAT_FMT_STR, m_pSystem->get_system_id(),
                       name.toUtf8().constData(), result);
         return false;
@@ -460,106 +683,117 @@ bool QAutopilotPrivate::sendExternCommand(const QString &name,
 
 template<>struct fmt::formatter<mavsdk::Telemetry::Result>:ostream_formatter{};
 
-void QAutopilotPrivate::setTelemetryRate() {
+void QAutopilotPrivate::setTelemetryRate(uint32_t rates) {
     if (!m_telemetry || !m_pSystem) {
         return;
     }
+    /// 无接收者的按需遥测：可停发的请求飞控停发，其余不再请求
+    rates &= ~(DemandDrivenRates & ~m_observedRates & ~StoppableRates);
+    /// 按当前关注度档位与链路带宽预算缩放配置频率
+    const double scale = QGCSConfigInternal::telemetryProfileScale(
+        q_func()->telemetryProfile()) * m_budgetScale;
+    const auto requestedHz = [this, scale](uint32_t rate, double configuredHz) {
+        /// MAVSDK 中负频率表示请求飞控停止发送该消息
+        return (rate & DemandDrivenRates) && !(rate & m_observedRates)
+            ? -1.0
+            : configuredHz * scale;
+    };
     const uint8_t systemId = m_pSystem->get_system_id();
-    /// 设置 位置信息 频率
-    m_telemetry->set_rate_position_async(
-        QGCSConfigInternal::telemetryPositionHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
+    const auto reportFailure = [systemId](const char *request, uint32_t rate) {
+        return [systemId, request, rate](mavsdk::Telemetry::Result result) {
             if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_position", result);
+                spdlog::error(PLAT_FMT_STR, systemId, request, result);
+                QGCSJournal::record(QJournalEvent::TelemetryRateFailed,
+                                    systemId, static_cast<int32_t>(rate),
+                                    static_cast<int64_t>(result));
             }
-        });
+        };
+    };
 
-    m_telemetry->set_rate_position_velocity_ned_async(
-        QGCSConfigInternal::telemetryPositionVelocityNedHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_position_velocity_ned", result);
-            }
-        });
+    /// 设置 位置信息 频率
+    if (rates & QGCSConfigInternal::TelemetryRatePosition) {
+        m_telemetry->set_rate_position_async(
+            requestedHz(QGCSConfigInternal::TelemetryRatePosition,
+                        QGCSConfigInternal::telemetryPositionHz()),
+            reportFailure("set_rate_position",
+                          QGCSConfigInternal::TelemetryRatePosition));
+    }
+
+    if (rates & QGCSConfigInternal::TelemetryRatePositionVelocityNed) {
+        m_telemetry->set_rate_position_velocity_ned_async(
+            requestedHz(QGCSConfigInternal::TelemetryRatePositionVelocityNed,
+                        QGCSConfigInternal::telemetryPositionVelocityNedHz()),
+            reportFailure("set_rate_position_velocity_ned",
+                          QGCSConfigInternal::TelemetryRatePositionVelocityNed));
+    }
 
     /// 设置 gps 状态 发送频率
-    m_telemetry->set_rate_gps_info_async(
-        QGCSConfigInternal::telemetryGpsInfoHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_gps_info", result);
-            }
-        });
+    if (rates & QGCSConfigInternal::TelemetryRateGpsInfo) {
+        m_telemetry->set_rate_gps_info_async(
+            requestedHz(QGCSConfigInternal::TelemetryRateGpsInfo,
+                        QGCSConfigInternal::telemetryGpsInfoHz()),
+            reportFailure("set_rate_gps_info",
+                          QGCSConfigInternal::TelemetryRateGpsInfo));
+    }
 
     /// 设置 电池信息 发送频率
-    m_telemetry->set_rate_battery_async(
-        QGCSConfigInternal::telemetryBatteryHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_battery", result);
-            }
-        });
+    if (rates & QGCSConfigInternal::TelemetryRateBattery) {
+        m_telemetry->set_rate_battery_async(
+            requestedHz(QGCSConfigInternal::TelemetryRateBattery,
+                        QGCSConfigInternal::telemetryBatteryHz()),
+            reportFailure("set_rate_battery",
+                          QGCSConfigInternal::TelemetryRateBattery));
+    }
 
-    m_telemetry->set_rate_raw_gps_async(
-        QGCSConfigInternal::telemetryRawGpsHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_raw_gps", result);
-            }
-        });
+    if (rates & QGCSConfigInternal::TelemetryRateRawGps) {
+        m_telemetry->set_rate_raw_gps_async(
+            requestedHz(QGCSConfigInternal::TelemetryRateRawGps,
+                        QGCSConfigInternal::telemetryRawGpsHz()),
+            reportFailure("set_rate_raw_gps",
+                          QGCSConfigInternal::TelemetryRateRawGps));
+    }
 
-    m_telemetry->set_rate_attitude_euler_async(
-        QGCSConfigInternal::telemetryAttitudeHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_attitude_euler", result);
-            }
-        });
+    if (rates & QGCSConfigInternal::TelemetryRateAttitude) {
+        m_telemetry->set_rate_attitude_euler_async(
+            requestedHz(QGCSConfigInternal::TelemetryRateAttitude,
+                        QGCSConfigInternal::telemetryAttitudeHz()),
+            reportFailure("set_rate_attitude_euler",
+                          QGCSConfigInternal::TelemetryRateAttitude));
+    }
 
-    m_telemetry->set_rate_landed_state_async(
-        QGCSConfigInternal::telemetryLandedStateHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_landed_state", result);
-            }
-        });
+    if (rates & QGCSConfigInternal::TelemetryRateLandedState) {
+        m_telemetry->set_rate_landed_state_async(
+            requestedHz(QGCSConfigInternal::TelemetryRateLandedState,
+                        QGCSConfigInternal::telemetryLandedStateHz()),
+            reportFailure("set_rate_landed_state",
+                          QGCSConfigInternal::TelemetryRateLandedState));
+    }
 
     /// 设置 健康度 发送频率
-    m_telemetry->set_rate_health_async(
-        QGCSConfigInternal::telemetryHealthHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_health", result);
-            }
-        });
+    if (rates & QGCSConfigInternal::TelemetryRateHealth) {
+        m_telemetry->set_rate_health_async(
+            requestedHz(QGCSConfigInternal::TelemetryRateHealth,
+                        QGCSConfigInternal::telemetryHealthHz()),
+            reportFailure("set_rate_health",
+                          QGCSConfigInternal::TelemetryRateHealth));
+    }
 
     /// 设置 home 发送频率
-    m_telemetry->set_rate_home_async(
-        QGCSConfigInternal::telemetryHomeHz(),
-        [systemId](mavsdk::Telemetry::Result result) {
-            if (mavsdk::Telemetry::Result::Success != result) {
-                spdlog::error(PLAT_FMT_STR, systemId,
-                              "set_rate_home", result);
-            }
-        });
+    if (rates & QGCSConfigInternal::TelemetryRateHome) {
+        m_telemetry->set_rate_home_async(
+            requestedHz(QGCSConfigInternal::TelemetryRateHome,
+                        QGCSConfigInternal::telemetryHomeHz()),
+            reportFailure("set_rate_home",
+                          QGCSConfigInternal::TelemetryRateHome));
+    }
 
-    if (hasFixedWingMetrics(q_func()->vehicleType())) {
+    if ((rates & QGCSConfigInternal::TelemetryRateFixedwingMetrics) &&
+        hasFixedWingMetrics(q_func()->vehicleType())) {
         m_telemetry->set_rate_fixedwing_metrics_async(
-            QGCSConfigInternal::telemetryFixedwingMetricsHz(),
-            [systemId](mavsdk::Telemetry::Result result) {
-                if (mavsdk::Telemetry::Result::Success != result) {
-                    spdlog::error(PLAT_FMT_STR, systemId,
-                                  "set_rate_fixedwing_metrics", result);
-                }
-            });
+            requestedHz(QGCSConfigInternal::TelemetryRateFixedwingMetrics,
+                        QGCSConfigInternal::telemetryFixedwingMetricsHz()),
+            reportFailure("set_rate_fixedwing_metrics",
+                          QGCSConfigInternal::TelemetryRateFixedwingMetrics));
     }
 
     /// 设置 遥控器状态 发送频率 Unsupported and System status is usually fixed at
@@ -571,6 +805,55 @@ void QAutopilotPrivate::setTelemetryRate() {
     //     });
 }
 
+double QAutopilotPrivate::telemetryDemandBytesPerSecond() const
+{
+    uint32_t rates = QGCSConfigInternal::TelemetryRateAll &
+                     ~(DemandDrivenRates & ~m_observedRates);
+    if (!hasFixedWingMetrics(q_func()->vehicleType())) {
+        rates &= ~QGCSConfigInternal::TelemetryRateFixedwingMetrics;
+    }
+    const double scale = QGCSConfigInternal::telemetryProfileScale(
+        q_func()->telemetryProfile());
+
+    constexpr uint32_t GpsRawRates = QGCSConfigInternal::TelemetryRateGpsInfo |
+                                     QGCSConfigInternal::TelemetryRateRawGps;
+    /// 心跳等固定开销由分配方从链路预算中扣除，不计入可缩放的需求
+    double bytesPerSecond = 0.0;
+    double gpsRawHz = 0.0;
+    double gpsRawFrameBytes = 0.0;
+    for (std::size_t bit = 0; bit < QTelemetryBudget::StreamFrameBytes.size();
+         ++bit) {
+        const uint32_t rate = 1u << bit;
+        if (!(rates & rate)) {
+            continue;
+        }
+        const double hz = QGCSConfigInternal::telemetryRateHz(rate) * scale;
+        if (rate & GpsRawRates) {
+            gpsRawHz = std::max(gpsRawHz, hz);
+            gpsRawFrameBytes = QTelemetryBudget::StreamFrameBytes[bit];
+        } else {
+            bytesPerSecond += hz * QTelemetryBudget::StreamFrameBytes[bit];
+        }
+    }
+    /// 两个频率位共用一条 GPS_RAW_INT，按较高的请求频率计一次
+    return bytesPerSecond + gpsRawHz * gpsRawFrameBytes;
+}
+
+bool QAutopilotPrivate::setTelemetryBudgetScale(double scale)
+{
+    scale = qBound(QTelemetryBudget::MinimumScale, scale, 1.0);
+    /// 小于 2% 的变化不重发 set_rate，避免链路抖动时反复请求
+    if (qAbs(scale - m_budgetScale) <= m_budgetScale * 0.02) {
+        return false;
+    }
+    m_budgetScale = scale;
+    if (m_pSystem) {
+        spdlog::debug(PLAT_FMT_STR, m_pSystem->get_system_id(),
+                      "telemetry budget scale", scale);
+    }
+    return true;
+}
+
 void QAutopilotPrivate::setupMessageHandling() {
     if (!m_telemetry || !m_pSystem) {
         return;
@@ -581,69 +864,43 @@ void QAutopilotPrivate::setupMessageHandling() {
     const QPointer<QAutopilot> autopilot(q_func());
     const uint8_t systemId = m_pSystem->get_system_id();
 
+    /// 高频遥测只写入最新值快照，由拥有者线程按帧间隔合并刷新
+    if (m_telemetrySnapshot) {
+        m_telemetrySnapshot->active = false;
+    }
+    const auto snapshot = std::make_shared<QAutopilotTelemetrySnapshot>();
+    snapshot->flushIntervalMs =
+        QGCSConfigInternal::telemetryFlushIntervalMs();
+    const QAutopilotMotionThresholds motionThresholds =
+        QAutopilotMotionThresholds::fromConfig(QGCSConfig::instance());
+    snapshot->reducer.setMotionThresholds(motionThresholds);
+    snapshot->motion.setThresholds(motionThresholds);
+    snapshot->reducer.reset(q_func()->telemetryState());
+    snapshot->inAir = q_func()->inAir();
+    if (QTelemetryWorkerPool *pool = QTelemetryWorkerPool::instance()) {
+        snapshot->worker = pool->contextFor(systemId);
+    }
+    m_telemetrySnapshot = snapshot;
+
     /// 位置信息
-    m_positionHandle = m_telemetry->subscribe_position([autopilot](
-                                        mavsdk::Telemetry::Position position) {
-        if (autopilot) {
-            QMetaObject::invokeMethod(
-                autopilot, "positionUpdate", Qt::QueuedConnection,
-                Q_ARG(double, position.longitude_deg),
-                Q_ARG(double, position.latitude_deg),
-                Q_ARG(float, position.absolute_altitude_m),
-                Q_ARG(float, position.relative_altitude_m));
-        }
-    });
+    m_positionHandle = m_telemetry->subscribe_position(
+        [autopilot, snapshot](mavsdk::Telemetry::Position position) {
+            snapshot->position.store(position);
+            publishTelemetry(autopilot, snapshot, TelemetryPosition);
+        });
 
     /// 航向
-    m_headingHandle = m_telemetry->subscribe_heading([autopilot](mavsdk::Telemetry::Heading heading) {
-        if (autopilot) {
-            QMetaObject::invokeMethod(
-                autopilot, "headingUpdate", Qt::QueuedConnection,
-                Q_ARG(double, heading.heading_deg));
-        }
-    });
-
-    /// 电池状态
-    m_batteryHandle = m_telemetry->subscribe_battery([autopilot](mavsdk::Telemetry::Battery battery) {
-        if (autopilot) {
-            QMetaObject::invokeMethod(
-                autopilot, "batteryUpdate", Qt::QueuedConnection,
-                Q_ARG(int, static_cast<int>(battery.id)),
-                Q_ARG(float, battery.temperature_degc),
-                Q_ARG(float, battery.voltage_v),
-                Q_ARG(float, battery.current_battery_a),
-                Q_ARG(float, battery.capacity_consumed_ah),
-                Q_ARG(float, battery.remaining_percent),
-                Q_ARG(float, battery.time_remaining_s),
-                Q_ARG(int, static_cast<int>(battery.battery_function)));
-        }
-    });
-
-    m_rawGpsHandle = m_telemetry->subscribe_raw_gps(
-        [autopilot](mavsdk::Telemetry::RawGps gps) {
-            if (autopilot) {
-                QMetaObject::invokeMethod(
-                    autopilot, "rawGpsUpdate", Qt::QueuedConnection,
-                    Q_ARG(float, gps.hdop),
-                    Q_ARG(float, gps.vdop),
-                    Q_ARG(float, gps.velocity_m_s),
-                    Q_ARG(float, gps.cog_deg),
-                    Q_ARG(float, gps.horizontal_uncertainty_m),
-                    Q_ARG(float, gps.vertical_uncertainty_m),
-                    Q_ARG(float, gps.velocity_uncertainty_m_s),
-                    Q_ARG(float, gps.heading_uncertainty_deg));
-            }
+    m_headingHandle = m_telemetry->subscribe_heading(
+        [autopilot, snapshot](mavsdk::Telemetry::Heading heading) {
+            snapshot->heading.store(heading);
+            publishTelemetry(autopilot, snapshot, TelemetryHeading);
         });
 
-    m_attitudeEulerHandle = m_telemetry->subscribe_attitude_euler(
-        [autopilot](mavsdk::Telemetry::EulerAngle attitude) {
-            if (autopilot) {
-                QMetaObject::invokeMethod(
-                    autopilot, "attitudeUpdate", Qt::QueuedConnection,
-                    Q_ARG(float, attitude.roll_deg),
-                    Q_ARG(float, attitude.pitch_deg),
-                    Q_ARG(float, attitude.yaw_deg));
-            }
+    /// 电池状态
+    m_batteryHandle = m_telemetry->subscribe_battery(
+        [autopilot, snapshot](mavsdk::Telemetry::Battery battery) {
+            snapshot->battery.store(battery);
+            publishTelemetry(autopilot, snapshot, TelemetryBattery);
         });
 
     m_flightModeHandle = m_telemetry->subscribe_flight_mode(
@@ -651,11 +908,10 @@ void QAutopilotPrivate::setupMessageHandling() {
             if (autopilot) {
                 std::ostringstream fallback;
                 fallback << mode;
-                QMetaObject::invokeMethod(
-                    autopilot, "flightModeUpdate", Qt::QueuedConnection,
-                    Q_ARG(QAutopilot::FlightMode,
-                          MavsdkTypeMap::toFlightMode(mode)),
-                    Q_ARG(QString, QString::fromStdString(fallback.str())));
+                QQueuedInvoke::post(
+                    autopilot, &QAutopilot::flightModeUpdate,
+                    MavsdkTypeMap::toFlightMode(mode),
+                    QString::fromStdString(fallback.str()));
             }
         });
 
@@ -664,11 +920,10 @@ void QAutopilotPrivate::setupMessageHandling() {
             if (autopilot) {
                 std::ostringstream fallback;
                 fallback << state;
-                QMetaObject::invokeMethod(
-                    autopilot, "landedStateUpdate", Qt::QueuedConnection,
-                    Q_ARG(QAutopilot::LandedState,
-                          MavsdkTypeMap::toLandedState(state)),
-                    Q_ARG(QString, QString::fromStdString(fallback.str())));
+                QQueuedInvoke::post(
+                    autopilot, &QAutopilot::landedStateUpdate,
+                    MavsdkTypeMap::toLandedState(state),
+                    QString::fromStdString(fallback.str()));
             }
         });
 
@@ -677,110 +932,190 @@ void QAutopilotPrivate::setupMessageHandling() {
             if (mavsdk::Telemetry::Result::Success != result) {
                 spdlog::error(PLAT_FMT_STR, systemId,
                               "set_rate_in_air", result);
+                QGCSJournal::record(QJournalEvent::TelemetryRateFailed,
+                                    systemId, 0,
+                                    static_cast<int64_t>(result));
             }
         });
 
     /// 健康状态
-    m_healthHandle = m_telemetry->subscribe_health([autopilot](mavsdk::Telemetry::Health h) {
-        if (autopilot) {
-            QMetaObject::invokeMethod(
-                autopilot, "healthUpdate", Qt::QueuedConnection,
-                Q_ARG(bool, h.is_gyrometer_calibration_ok),
-                Q_ARG(bool, h.is_accelerometer_calibration_ok),
-                Q_ARG(bool, h.is_magnetometer_calibration_ok),
-                Q_ARG(bool, h.is_local_position_ok),
-                Q_ARG(bool, h.is_global_position_ok),
-                Q_ARG(bool, h.is_home_position_ok),
-                Q_ARG(bool, h.is_armable));
-        }
-    });
+    m_healthHandle = m_telemetry->subscribe_health(
+        [autopilot, snapshot](mavsdk::Telemetry::Health health) {
+            snapshot->health.store(health);
+            publishTelemetry(autopilot, snapshot, TelemetryHealth);
+        });
 
     /// GPS状态
     m_gpsInfoHandle = m_telemetry->subscribe_gps_info(
-        [autopilot](mavsdk::Telemetry::GpsInfo gps) {
-        if (autopilot) {
-            QMetaObject::invokeMethod(
-                autopilot, "gpsInfoUpdate", Qt::QueuedConnection,
-                Q_ARG(int, gps.num_satellites),
-                Q_ARG(int, static_cast<int>(gps.fix_type)));
-        }
+        [autopilot, snapshot](mavsdk::Telemetry::GpsInfo gps) {
+            snapshot->gpsInfo.store(gps);
+            publishTelemetry(autopilot, snapshot, TelemetryGpsInfo);
         });
 
     /// 本地坐标
     m_positionVelocityHandle =
         m_telemetry->subscribe_position_velocity_ned(
-        [autopilot](mavsdk::Telemetry::PositionVelocityNed pvNed) {
-            // 通过Qt元系统调用parent的nedUpdate方法
-            if (autopilot) {
-                QMetaObject::invokeMethod(
-                    autopilot, "nedUpdate", Qt::QueuedConnection,
-                    Q_ARG(float, pvNed.position.north_m),
-                    Q_ARG(float, pvNed.position.east_m),
-                    Q_ARG(float, pvNed.position.down_m),
-                    Q_ARG(float, pvNed.velocity.north_m_s),
-                    Q_ARG(float, pvNed.velocity.east_m_s),
-                    Q_ARG(float, pvNed.velocity.down_m_s));
-            }
+        [autopilot, snapshot](mavsdk::Telemetry::PositionVelocityNed pvNed) {
+            snapshot->positionVelocityNed.store(pvNed);
+            /// 移动判定按样本去抖，须在合并之前计数
+            snapshot->motion.sample(pvNed.velocity.north_m_s,
+                                    pvNed.velocity.east_m_s,
+                                    pvNed.velocity.down_m_s,
+                                    snapshot->inAir.load());
+            publishTelemetry(autopilot, snapshot,
+                             TelemetryPositionVelocityNed);
         });
 
     m_armedHandle = m_telemetry->subscribe_armed(
         [autopilot](bool armed) {
-            if (autopilot) {
-                QMetaObject::invokeMethod(
-                    autopilot, "armedUpdate", Qt::QueuedConnection,
-                    Q_ARG(bool, armed));
-            }
+            QQueuedInvoke::post(autopilot, &QAutopilot::armedUpdate, armed);
         });
 
     m_inAirHandle = m_telemetry->subscribe_in_air(
-        [autopilot](bool inAir) {
-            if (autopilot) {
-                QMetaObject::invokeMethod(
-                    autopilot, "inAirUpdate", Qt::QueuedConnection,
-                    Q_ARG(bool, inAir));
-            }
+        [autopilot, snapshot](bool inAir) {
+            snapshot->inAir = inAir;
+            publishTelemetry(autopilot, snapshot, TelemetryInAir);
+            QQueuedInvoke::post(autopilot, &QAutopilot::inAirUpdate, inAir);
         });
 
-    /// 订阅home点
-    m_homeHandle = m_telemetry->subscribe_home([autopilot](mavsdk::Telemetry::Position home) {
-        // 通过Qt元系统调用parent的homeUpdate方法
-        if (autopilot) {
-            QMetaObject::invokeMethod(
-                autopilot, "homeUpdate", Qt::QueuedConnection,
-                Q_ARG(double, home.longitude_deg),
-                Q_ARG(double, home.latitude_deg),
-                Q_ARG(float, home.absolute_altitude_m));
-        }
-    });
-
     /// 订阅 rc状态
-    m_rcStatusHandle = m_telemetry->subscribe_rc_status([autopilot](
-                                         mavsdk::Telemetry::RcStatus rcStatus) {
-        // 通过Qt元系统调用parent的rcStatusUpdate方法
-        if (autopilot) {
-            QMetaObject::invokeMethod(
-                autopilot, "rcStatusUpdate", Qt::QueuedConnection,
-                Q_ARG(bool, rcStatus.is_available),
-                Q_ARG(float, rcStatus.signal_strength_percent));
-        }
-    });
+    m_rcStatusHandle = m_telemetry->subscribe_rc_status(
+        [autopilot, snapshot](mavsdk::Telemetry::RcStatus rcStatus) {
+            snapshot->rcStatus.store(rcStatus);
+            publishTelemetry(autopilot, snapshot, TelemetryRcStatus);
+        });
 
-    if (hasFixedWingMetrics(q_func()->vehicleType())) {
-        m_fixedwingMetricsHandle = m_telemetry->subscribe_fixedwing_metrics(
-            [autopilot](mavsdk::Telemetry::FixedwingMetrics metrics) {
-                if (autopilot) {
-                    QMetaObject::invokeMethod(
-                        autopilot, "fixedwingUpdate", Qt::QueuedConnection,
-                        Q_ARG(float, metrics.airspeed_m_s),
-                        Q_ARG(float, metrics.throttle_percentage),
-                        Q_ARG(float, metrics.climb_rate_m_s),
-                        Q_ARG(float, metrics.groundspeed_m_s),
-                        Q_ARG(float, metrics.heading_deg),
-                        Q_ARG(float, metrics.absolute_altitude_m));
-                }
-            });
-    }
+    /// 姿态、原始 GPS、Home、固定翼指标只在有接收者时订阅
+    m_observedRates = q_func()->observedTelemetryRates();
+    subscribeDemandTelemetry(m_observedRates);
 
     /// 开始订阅消息
     setTelemetryRate();
 }
+
+void QAutopilotPrivate::flushTelemetrySnapshot(
+    const QPointer<QAutopilot> &autopilot,
+    const std::shared_ptr<QAutopilotTelemetrySnapshot> &snapshot)
+{
+    if (!autopilot || !snapshot || !snapshot->active) {
+        return;
+    }
+    QGCS_TRACE_SCOPE("telemetry", "flushTelemetrySnapshot");
+
+    /// 帧间隔内的后续刷新合并到下一帧
+    QObject *context = snapshot->worker ? snapshot->worker : autopilot.data();
+    if (snapshot->lastFlush.isValid()) {
+        const qint64 remainingMs =
+            snapshot->flushIntervalMs - snapshot->lastFlush.elapsed();
+        if (remainingMs > 0) {
+            QTimer::singleShot(
+                static_cast<int>(remainingMs), context,
+                [autopilot, snapshot]() {
+                    flushTelemetrySnapshot(autopilot, snapshot);
+                });
+            return;
+        }
+    }
+    snapshot->lastFlush.start();
+
+    /// 先清除投递标记再取脏位，保证之后的写入会再投递一次刷新
+    snapshot->flushPending = false;
+    const quint32 dirty = snapshot->dirty.exchange(0);
+    QAutopilotTelemetryReducer &reducer = snapshot->reducer;
+
+    if (dirty & TelemetryPosition) {
+        const auto position = snapshot->position.load();
+        reducer.position(position.longitude_deg, position.latitude_deg,
+                         position.absolute_altitude_m,
+                         position.relative_altitude_m);
+    }
+    if (dirty & TelemetryHome) {
+        const auto home = snapshot->home.load();
+        reducer.home(home.longitude_deg, home.latitude_deg,
+                     home.absolute_altitude_m);
+    }
+    if (dirty & TelemetryHeading) {
+        reducer.heading(snapshot->heading.load().heading_deg);
+    }
+    if (dirty & TelemetryAttitude) {
+        const auto attitude = snapshot->attitude.load();
+        reducer.attitude(attitude.roll_deg, attitude.pitch_deg,
+                         attitude.yaw_deg);
+    }
+    if (dirty & TelemetryInAir) {
+        reducer.inAir(snapshot->inAir.load());
+    }
+    if (dirty & TelemetryPositionVelocityNed) {
+        const auto pvNed = snapshot->positionVelocityNed.load();
+        reducer.ned(pvNed.position.north_m, pvNed.position.east_m,
+                    pvNed.position.down_m, pvNed.velocity.north_m_s,
+                    pvNed.velocity.east_m_s, pvNed.velocity.down_m_s);
+        reducer.motion(snapshot->motion.load());
+    }
+    if (dirty & TelemetryGpsInfo) {
+        const auto gps = snapshot->gpsInfo.load();
+        reducer.gpsInfo(gps.num_satellites, static_cast<int>(gps.fix_type));
+    }
+    if (dirty & TelemetryBattery) {
+        const auto battery = snapshot->battery.load();
+        reducer.battery(static_cast<int>(battery.id),
+                        battery.temperature_degc, battery.voltage_v,
+                        battery.current_battery_a,
+                        battery.capacity_consumed_ah,
+                        battery.remaining_percent,
+                        battery.time_remaining_s,
+                        static_cast<int>(battery.battery_function));
+    }
+    if (dirty & TelemetryRawGps) {
+        const auto gps = snapshot->rawGps.load();
+        reducer.rawGps(gps.hdop, gps.vdop, gps.velocity_m_s, gps.cog_deg,
+                       gps.horizontal_uncertainty_m,
+                       gps.vertical_uncertainty_m,
+                       gps.velocity_uncertainty_m_s,
+                       gps.heading_uncertainty_deg);
+    }
+    if (dirty & TelemetryHealth) {
+        const auto health = snapshot->health.load();
+        reducer.health(health.is_gyrometer_calibration_ok,
+                       health.is_accelerometer_calibration_ok,
+                       health.is_magnetometer_calibration_ok,
+                       health.is_local_position_ok,
+                       health.is_global_position_ok,
+                       health.is_home_position_ok, health.is_armable);
+    }
+    if (dirty & TelemetryRcStatus) {
+        const auto rcStatus = snapshot->rcStatus.load();
+        reducer.rcStatus(rcStatus.is_available,
+                         rcStatus.signal_strength_percent);
+    }
+    if (dirty & TelemetryFixedwingMetrics) {
+        const auto metrics = snapshot->fixedwingMetrics.load();
+        reducer.fixedwing(metrics.airspeed_m_s, metrics.throttle_percentage,
+                          metrics.climb_rate_m_s, metrics.groundspeed_m_s,
+                          metrics.heading_deg, metrics.absolute_altitude_m);
+    }
+
+    QAutopilotTelemetryChanges changes = reducer.takeChanges();
+    for (std::size_t index = 0; index < changes.sampleTimeNs.size(); ++index) {
+        if (dirty & (1u << index)) {
+            changes.sampleTimeNs[index] = snapshot->sampleTimeNs[index].exchange(
+                0, std::memory_order_relaxed);
+        }
+    }
+    if (changes.isEmpty()) {
+        return;
+    }
+    if (!snapshot->worker) {
+        autopilot->applyTelemetryChanges(changes);
+        return;
+    }
+    /// 只有变化集合跨线程回到 QAutopilot
+    QMetaObject::invokeMethod(
+        autopilot.data(),
+        [autopilot, snapshot, changes = std::move(changes)]() {
+            if (autopilot && snapshot->active) {
+                autopilot->applyTelemetryChanges(changes);
+            }
+        },
+        Qt::QueuedConnection);
+}
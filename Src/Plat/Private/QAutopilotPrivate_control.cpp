@@ -6,78 +6,11 @@
 #include <utility>
 
 #include "Plat/Private/QAutopilotPrivate.h"
+#include "Plat/Private/QMavsdkTypeMap.h"
 #include "Plat/QAutopilot.h"
+#include "Private/QGCSTrace.h"
 #include "Private/QMavsdkTextCatalog.h"
 
-namespace {
-QMissionPoint missionPointFromMavsdk(
-    const mavsdk::Mission::MissionItem &item)
-{
-    QMissionPoint::Action action = QMissionPoint::ContinueAction;
-    double durationS = 0.0;
-    if (item.vehicle_action ==
-        mavsdk::Mission::MissionItem::VehicleAction::Land) {
-        action = QMissionPoint::LandAction;
-    } else if (item.camera_action ==
-               mavsdk::Mission::MissionItem::CameraAction::TakePhoto) {
-        action = QMissionPoint::TakePhotoAction;
-    } else if (item.camera_action ==
-               mavsdk::Mission::MissionItem::CameraAction::StartVideo) {
-        action = QMissionPoint::RecordVideoAction;
-        durationS = std::isfinite(item.loiter_time_s)
-            ? item.loiter_time_s : 0.0;
-    } else if (std::isfinite(item.loiter_time_s) &&
-               item.loiter_time_s > 0.0f) {
-        action = QMissionPoint::WaitAction;
-        durationS = item.loiter_time_s;
-    }
-
-    const double speedMS = std::isfinite(item.speed_m_s)
-        ? item.speed_m_s : 0.0;
-    return QMissionPoint(
-        QGpsPosition(item.longitude_deg, item.latitude_deg,
-                     item.relative_altitude_m),
-        action, durationS, speedMS, item.is_fly_through);
-}
-
-mavsdk::Mission::MissionItem mavsdkItemFromMissionPoint(
-    const QMissionPoint &point)
-{
-    mavsdk::Mission::MissionItem item;
-    const QGpsPosition position = point.position();
-    item.latitude_deg = position.latitude();
-    item.longitude_deg = position.longitude();
-    item.relative_altitude_m = position.altitude();
-    item.is_fly_through = point.flyThrough();
-    if (point.speedMS() > 0.0) {
-        item.speed_m_s = static_cast<float>(point.speedMS());
-    }
-
-    switch (point.action()) {
-    case QMissionPoint::ContinueAction:
-        item.is_fly_through = true;
-        break;
-    case QMissionPoint::WaitAction:
-        item.loiter_time_s = static_cast<float>(point.actionDurationS());
-        break;
-    case QMissionPoint::TakePhotoAction:
-        item.camera_action =
-            mavsdk::Mission::MissionItem::CameraAction::TakePhoto;
-        break;
-    case QMissionPoint::RecordVideoAction:
-        item.camera_action =
-            mavsdk::Mission::MissionItem::CameraAction::StartVideo;
-        item.loiter_time_s = static_cast<float>(point.actionDurationS());
-        break;
-    case QMissionPoint::LandAction:
-        item.vehicle_action =
-            mavsdk::Mission::MissionItem::VehicleAction::Land;
-        break;
-    }
-    return item;
-}
-} // namespace
-
 void QAutopilotPrivate::downloadAirLine(quint64 requestId)
 {
     QPointer<QAutopilot> autopilot = q_func();
@@ -90,9 +23,14 @@ void QAutopilotPrivate::downloadAirLine(quint64 requestId)
         return;
     }
 
+    const int64_t traceStartUs = QGCS_TRACE_NOW();
+    const int systemId = autopilot->vehicleId();
     m_mission->download_mission_async(
-        [autopilot, requestId](mavsdk::Mission::Result result,
-                               mavsdk::Mission::MissionPlan missionPlan) {
+        [autopilot, requestId, traceStartUs, systemId](
+            mavsdk::Mission::Result result,
+            mavsdk::Mission::MissionPlan missionPlan) {
+        QGCS_TRACE_COMPLETE("mission", "downloadMission", traceStartUs,
+                            systemId);
         if (!autopilot) {
             return;
         }
@@ -102,7 +40,7 @@ void QAutopilotPrivate::downloadAirLine(quint64 requestId)
                 [autopilot, requestId, result]() {
                     if (autopilot) {
                         const QString reason = QMavsdkTextCatalog::text(
-                            QStringLiteral("missionResult"),
+                            QMavsdkTextCatalog::MissionResult,
                             static_cast<int>(result));
                         autopilot->failAirLineDownload(requestId, reason);
                     }
@@ -132,7 +70,7 @@ void QAutopilotPrivate::downloadAirLine(quint64 requestId)
                     mavsdk::Mission::MissionItem::CameraAction::StopVideo) {
                     continue;
                 }
-                points.append(missionPointFromMavsdk(item));
+                points.append(MavsdkTypeMap::missionPointFromMavsdk(item));
             }
 
             QMetaObject::invokeMethod(
@@ -166,10 +104,10 @@ void QAutopilotPrivate::uploadAirLine(
     missionPlan.mission_items.reserve(static_cast<std::size_t>(points.size()));
     for (const QMissionPoint &point : points) {
         missionPlan.mission_items.push_back(
-            mavsdkItemFromMissionPoint(point));
+            MavsdkTypeMap::mavsdkItemFromMissionPoint(point));
         if (point.action() == QMissionPoint::RecordVideoAction) {
             mavsdk::Mission::MissionItem stopItem =
-                mavsdkItemFromMissionPoint(point);
+                MavsdkTypeMap::mavsdkItemFromMissionPoint(point);
             stopItem.camera_action =
                 mavsdk::Mission::MissionItem::CameraAction::StopVideo;
             stopItem.loiter_time_s = 0.0f;
@@ -186,12 +124,16 @@ void QAutopilotPrivate::uploadAirLine(
             return;
         }
 
-        mavsdk::Mission mission(system);
-        mavsdk::Mission::Result result =
-            mission.set_return_to_launch_after_mission(
+        mavsdk::Mission::Result result;
+        {
+            QGCS_TRACE_SCOPE_ID("mission", "uploadMission",
+                                system->get_system_id());
+            mavsdk::Mission mission(system);
+            result = mission.set_return_to_launch_after_mission(
                 returnHomeAfterMission);
-        if (result == mavsdk::Mission::Result::Success) {
-            result = mission.upload_mission(std::move(missionPlan));
+            if (result == mavsdk::Mission::Result::Success) {
+                result = mission.upload_mission(std::move(missionPlan));
+            }
         }
 
         if (result != mavsdk::Mission::Result::Success) {
@@ -200,7 +142,7 @@ void QAutopilotPrivate::uploadAirLine(
                 [autopilot, requestId, result]() {
                     if (autopilot) {
                         const QString reason = QMavsdkTextCatalog::text(
-                            QStringLiteral("missionResult"),
+                            QMavsdkTextCatalog::MissionResult,
                             static_cast<int>(result));
                         autopilot->failAirLineUpload(requestId, reason);
                     }
@@ -245,7 +187,7 @@ void QAutopilotPrivate::startAirLine()
                 }
                 if (result != mavsdk::Mission::Result::Success) {
                     const QString reason = QMavsdkTextCatalog::text(
-                        QStringLiteral("missionResult"),
+                        QMavsdkTextCatalog::MissionResult,
                         static_cast<int>(result));
                     emit autopilot->airLineStartFailed(reason);
                     return;
@@ -283,7 +225,7 @@ void QAutopilotPrivate::pauseAirLine()
                 if (result != mavsdk::Mission::Result::Success) {
                     emit autopilot->airLinePauseFailed(
                         QMavsdkTextCatalog::text(
-                            QStringLiteral("missionResult"),
+                            QMavsdkTextCatalog::MissionResult,
                             static_cast<int>(result)));
                     return;
                 }
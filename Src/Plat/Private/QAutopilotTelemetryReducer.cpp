@@ -0,0 +1,406 @@
+#include "Plat/Private/QAutopilotTelemetryReducer.h"
+#include "Private/QMavsdkTextCatalog.h"
+#include "QGCSConfig.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+QAutopilotMotionThresholds QAutopilotMotionThresholds::fromConfig(
+    const QGCSConfig *config)
+{
+    QAutopilotMotionThresholds thresholds;
+    if (!config) {
+        return thresholds;
+    }
+    thresholds.startHorizontalSpeedMS = config->motionStartHorizontalSpeedMS();
+    thresholds.startVerticalSpeedMS = config->motionStartVerticalSpeedMS();
+    thresholds.stopHorizontalSpeedMS = config->motionStopHorizontalSpeedMS();
+    thresholds.stopVerticalSpeedMS = config->motionStopVerticalSpeedMS();
+    thresholds.startSampleCount = config->motionStartSampleCount();
+    thresholds.stopSampleCount = config->motionStopSampleCount();
+    return thresholds;
+}
+
+void QAutopilotMotionCounter::setThresholds(
+    const QAutopilotMotionThresholds &thresholds)
+{
+    m_thresholds = thresholds;
+}
+
+void QAutopilotMotionCounter::sample(float velocityNorth, float velocityEast,
+                                     float velocityDown, bool inAir)
+{
+    const double northSpeed = static_cast<double>(velocityNorth);
+    const double eastSpeed = static_cast<double>(velocityEast);
+    const double downSpeed = static_cast<double>(velocityDown);
+    if (!std::isfinite(northSpeed) ||
+        !std::isfinite(eastSpeed) ||
+        !std::isfinite(downSpeed)) {
+        return;
+    }
+
+    const double groundSpeed = std::hypot(northSpeed, eastSpeed);
+    const double verticalSpeed = std::abs(downSpeed);
+    const bool movementCandidate =
+        inAir ||
+        groundSpeed >= m_thresholds.startHorizontalSpeedMS ||
+        verticalSpeed >= m_thresholds.startVerticalSpeedMS;
+    const bool stationaryCandidate =
+        !inAir &&
+        groundSpeed <= m_thresholds.stopHorizontalSpeedMS &&
+        verticalSpeed <= m_thresholds.stopVerticalSpeedMS;
+
+    const quint64 counts = m_counts.load(std::memory_order_relaxed);
+    const quint32 start = static_cast<quint32>(counts);
+    const quint32 stop = static_cast<quint32>(counts >> 32);
+    const quint32 nextStart =
+        movementCandidate ? std::min<quint32>(start + 1, INT_MAX) : 0;
+    const quint32 nextStop =
+        stationaryCandidate ? std::min<quint32>(stop + 1, INT_MAX) : 0;
+    m_counts.store(static_cast<quint64>(nextStop) << 32 | nextStart,
+                   std::memory_order_release);
+}
+
+QAutopilotMotionSamples QAutopilotMotionCounter::load() const
+{
+    const quint64 counts = m_counts.load(std::memory_order_acquire);
+    QAutopilotMotionSamples samples;
+    samples.startCount = static_cast<int>(static_cast<quint32>(counts));
+    samples.stopCount = static_cast<int>(static_cast<quint32>(counts >> 32));
+    return samples;
+}
+
+void QAutopilotTelemetryReducer::reset(const QAutopilotTelemetryState &state)
+{
+    m_state = state;
+    m_fields = 0;
+    m_motionSamples = {};
+}
+
+void QAutopilotTelemetryReducer::setMotionThresholds(
+    const QAutopilotMotionThresholds &thresholds)
+{
+    m_thresholds = thresholds;
+}
+
+QAutopilotTelemetryChanges QAutopilotTelemetryReducer::takeChanges()
+{
+    QAutopilotTelemetryChanges changes;
+    changes.fields = m_fields;
+    if (m_fields != 0) {
+        changes.state = m_state;
+        m_fields = 0;
+    }
+    return changes;
+}
+
+void QAutopilotTelemetryReducer::position(double dLon, double dLat, float dH,
+                                          float relativeAltitudeM)
+{
+    const bool firstPosition = !m_state.hasGpsPosition;
+    if (firstPosition ||
+        !qFuzzyCompare(m_state.gpsPosition.longitude(), dLon) ||
+        !qFuzzyCompare(m_state.gpsPosition.latitude(), dLat) ||
+        !qFuzzyCompare(m_state.gpsPosition.altitude(), dH)) {
+        m_state.hasGpsPosition = true;
+        m_state.gpsPosition.setLongitude(dLon);
+        m_state.gpsPosition.setLatitude(dLat);
+        m_state.gpsPosition.setAltitude(dH);
+        if (firstPosition) {
+            m_fields |= QAutopilotTelemetryChanges::HasGpsPosition;
+        }
+        m_fields |= QAutopilotTelemetryChanges::GpsPosition;
+    }
+    if (!qFuzzyCompare(m_state.relativeAltitudeM,
+                       static_cast<double>(relativeAltitudeM))) {
+        m_state.relativeAltitudeM = relativeAltitudeM;
+        m_fields |= QAutopilotTelemetryChanges::PositionDetails;
+    }
+}
+
+void QAutopilotTelemetryReducer::ned(float dNorth, float dEast, float dDown,
+                                     float velocityNorth, float velocityEast,
+                                     float velocityDown)
+{
+    QNEDPosition &position = m_state.nedPosition;
+    if (!qFuzzyCompare(position.north(), dNorth) ||
+        !qFuzzyCompare(position.east(), dEast) ||
+        !qFuzzyCompare(position.down(), dDown)) {
+        position.setNorth(dNorth);
+        position.setEast(dEast);
+        position.setDown(dDown);
+        m_fields |= QAutopilotTelemetryChanges::NedPosition;
+    }
+
+    const double northSpeed = static_cast<double>(velocityNorth);
+    const double eastSpeed = static_cast<double>(velocityEast);
+    const double downSpeed = static_cast<double>(velocityDown);
+    if (!std::isfinite(northSpeed) ||
+        !std::isfinite(eastSpeed) ||
+        !std::isfinite(downSpeed)) {
+        return;
+    }
+
+    QVelocity next(northSpeed, eastSpeed, downSpeed);
+    if (m_state.velocity != next) {
+        m_state.velocity = next;
+        m_fields |= QAutopilotTelemetryChanges::Velocity;
+    }
+}
+
+void QAutopilotTelemetryReducer::inAir(bool inAir)
+{
+    if (m_state.inAir == inAir) {
+        return;
+    }
+    m_state.inAir = inAir;
+    updateMovingState();
+}
+
+void QAutopilotTelemetryReducer::motion(const QAutopilotMotionSamples &samples)
+{
+    m_motionSamples = samples;
+    updateMovingState();
+}
+
+void QAutopilotTelemetryReducer::updateMovingState()
+{
+    /// 空中即为移动；地面按连续样本数去抖，至少需要一个样本
+    const int startSamples = qMax(1, m_thresholds.startSampleCount);
+    const int stopSamples = qMax(1, m_thresholds.stopSampleCount);
+    const bool nextMoving = m_state.moving
+        ? m_state.inAir || m_motionSamples.stopCount < stopSamples
+        : m_state.inAir || m_motionSamples.startCount >= startSamples;
+
+    if (m_state.moving != nextMoving) {
+        m_state.moving = nextMoving;
+        m_fields |= QAutopilotTelemetryChanges::Moving;
+    }
+}
+
+void QAutopilotTelemetryReducer::gpsInfo(int gpsCount, int gpsStatus)
+{
+    QAutopilotStatus &status = m_state.status;
+    if (status.gpsCount() != gpsCount) {
+        status.setGpsCount(gpsCount);
+        m_fields |= QAutopilotTelemetryChanges::Status;
+    }
+
+    const QString chineseStatus =
+        QMavsdkTextCatalog::text(QMavsdkTextCatalog::GpsFixType, gpsStatus);
+    if (status.gpsStatus() != chineseStatus) {
+        status.setGpsStatus(chineseStatus);
+        m_fields |= QAutopilotTelemetryChanges::Status;
+    }
+}
+
+void QAutopilotTelemetryReducer::battery(int batteryId, float temperatureC,
+                                         float batteryVoltage,
+                                         float batteryCurrentA,
+                                         float consumedAh,
+                                         float batteryRemaining,
+                                         float timeRemainingS,
+                                         int batteryFunction)
+{
+    QAutopilotStatus &status = m_state.status;
+    bool changed = false;
+
+    if (!qFuzzyCompare(status.batteryVoltage(), batteryVoltage)) {
+        status.setBatteryVoltage(batteryVoltage);
+        changed = true;
+    }
+    if (!qFuzzyCompare(status.batteryRemaining(), batteryRemaining)) {
+        status.setBatteryRemaining(batteryRemaining);
+        changed = true;
+    }
+    if (status.batteryId() != batteryId) {
+        status.setBatteryId(batteryId);
+        changed = true;
+    }
+    if (!qFuzzyCompare(status.batteryTemperatureC(), temperatureC)) {
+        status.setBatteryTemperatureC(temperatureC);
+        changed = true;
+    }
+    if (!qFuzzyCompare(status.batteryCurrentA(), batteryCurrentA)) {
+        status.setBatteryCurrentA(batteryCurrentA);
+        changed = true;
+    }
+    if (!qFuzzyCompare(status.batteryConsumedAh(), consumedAh)) {
+        status.setBatteryConsumedAh(consumedAh);
+        changed = true;
+    }
+    if (!qFuzzyCompare(status.batteryTimeRemainingS(), timeRemainingS)) {
+        status.setBatteryTimeRemainingS(timeRemainingS);
+        changed = true;
+    }
+    const QString function = QMavsdkTextCatalog::text(
+        QMavsdkTextCatalog::BatteryFunction, batteryFunction);
+    if (status.batteryFunction() != function) {
+        status.setBatteryFunction(function);
+        changed = true;
+    }
+
+    if (changed) {
+        m_fields |= QAutopilotTelemetryChanges::Status;
+    }
+}
+
+void QAutopilotTelemetryReducer::attitude(float rollDeg, float pitchDeg,
+                                          float yawDeg)
+{
+    QAttitude next = m_state.attitude;
+    next.setRollDeg(rollDeg);
+    next.setPitchDeg(pitchDeg);
+    next.setYawDeg(yawDeg);
+    if (m_state.attitude == next) {
+        return;
+    }
+    m_state.attitude = next;
+    m_fields |= QAutopilotTelemetryChanges::Attitude;
+}
+
+void QAutopilotTelemetryReducer::heading(double heading)
+{
+    if (qFuzzyCompare(m_state.attitude.headingDeg(), heading)) {
+        return;
+    }
+    m_state.attitude.setHeadingDeg(heading);
+    m_fields |= QAutopilotTelemetryChanges::Attitude;
+}
+
+void QAutopilotTelemetryReducer::rawGps(float hdop, float vdop,
+                                        float velocityMS, float courseDeg,
+                                        float horizontalUncertaintyM,
+                                        float verticalUncertaintyM,
+                                        float velocityUncertaintyMS,
+                                        float headingUncertaintyDeg)
+{
+    QRawGps next = m_state.rawGps;
+    next.setHdop(hdop);
+    next.setVdop(vdop);
+    next.setVelocityMS(velocityMS);
+    next.setCourseDeg(courseDeg);
+    next.setHorizontalUncertaintyM(horizontalUncertaintyM);
+    next.setVerticalUncertaintyM(verticalUncertaintyM);
+    next.setVelocityUncertaintyMS(velocityUncertaintyMS);
+    next.setHeadingUncertaintyDeg(headingUncertaintyDeg);
+    if (m_state.rawGps == next) {
+        return;
+    }
+    m_state.rawGps = next;
+    m_fields |= QAutopilotTelemetryChanges::RawGps;
+}
+
+void QAutopilotTelemetryReducer::rcStatus(bool isAvailable,
+                                          float signalStrengthPercent)
+{
+    QAutopilotStatus &status = m_state.status;
+    if (status.rcIsAvailable() != isAvailable) {
+        status.setRcIsAvailable(isAvailable);
+        m_fields |= QAutopilotTelemetryChanges::Status;
+    }
+    if (!qFuzzyCompare(status.rcSignalStrengthPercent(),
+                       signalStrengthPercent)) {
+        status.setRcSignalStrengthPercent(signalStrengthPercent);
+        m_fields |= QAutopilotTelemetryChanges::Status;
+    }
+}
+
+void QAutopilotTelemetryReducer::health(bool isGyrometerCalibrationOk,
+                                        bool isAccelerometerCalibrationOk,
+                                        bool isMagnetometerCalibrationOk,
+                                        bool isLocalPositionOk,
+                                        bool isGlobalPositionOk,
+                                        bool isHomePositionOk,
+                                        bool isArmable)
+{
+    QAutopilotStatus &status = m_state.status;
+    bool changed = false;
+
+    if (status.isGyrometerCalibrationOk() != isGyrometerCalibrationOk) {
+        status.setGyrometerCalibrationOk(isGyrometerCalibrationOk);
+        changed = true;
+    }
+    if (status.isAccelerometerCalibrationOk() !=
+        isAccelerometerCalibrationOk) {
+        status.setAccelerometerCalibrationOk(isAccelerometerCalibrationOk);
+        changed = true;
+    }
+    if (status.isMagnetometerCalibrationOk() != isMagnetometerCalibrationOk) {
+        status.setMagnetometerCalibrationOk(isMagnetometerCalibrationOk);
+        changed = true;
+    }
+    if (status.isLocalPositionOk() != isLocalPositionOk) {
+        status.setLocalPositionOk(isLocalPositionOk);
+        changed = true;
+    }
+    if (status.isGlobalPositionOk() != isGlobalPositionOk) {
+        status.setGlobalPositionOk(isGlobalPositionOk);
+        changed = true;
+    }
+    if (status.isHomePositionOk() != isHomePositionOk) {
+        status.setHomePositionOk(isHomePositionOk);
+        changed = true;
+    }
+    if (status.isArmable() != isArmable) {
+        status.setArmable(isArmable);
+        changed = true;
+    }
+
+    if (changed) {
+        m_fields |= QAutopilotTelemetryChanges::Status;
+    }
+}
+
+void QAutopilotTelemetryReducer::home(double dLon, double dLat, float dH)
+{
+    QGpsPosition &home = m_state.homePosition;
+    if (!qFuzzyCompare(home.longitude(), dLon) ||
+        !qFuzzyCompare(home.latitude(), dLat) ||
+        !qFuzzyCompare(home.altitude(), dH)) {
+        home.setLongitude(dLon);
+        home.setLatitude(dLat);
+        home.setAltitude(dH);
+        m_fields |= QAutopilotTelemetryChanges::HomePosition;
+    }
+}
+
+void QAutopilotTelemetryReducer::fixedwing(float airspeedMS,
+                                           float throttlePercentage,
+                                           float climbRateMS,
+                                           float groundspeedMS,
+                                           float headingDeg,
+                                           float absoluteAltitudeM)
+{
+    QAutopilotFixedwing &fixedwing = m_state.fixedwing;
+    bool changed = false;
+
+    if (!qFuzzyCompare(fixedwing.airspeedMS(), airspeedMS)) {
+        fixedwing.setAirspeedMS(airspeedMS);
+        changed = true;
+    }
+    if (!qFuzzyCompare(fixedwing.throttlePercentage(), throttlePercentage)) {
+        fixedwing.setThrottlePercentage(throttlePercentage);
+        changed = true;
+    }
+    if (!qFuzzyCompare(fixedwing.climbRateMS(), climbRateMS)) {
+        fixedwing.setClimbRateMS(climbRateMS);
+        changed = true;
+    }
+    if (!qFuzzyCompare(fixedwing.groundspeedMS(), groundspeedMS)) {
+        fixedwing.setGroundspeedMS(groundspeedMS);
+        changed = true;
+    }
+    if (!qFuzzyCompare(fixedwing.headingDeg(), headingDeg)) {
+        fixedwing.setHeadingDeg(headingDeg);
+        changed = true;
+    }
+    if (!qFuzzyCompare(fixedwing.absoluteAltitudeM(), absoluteAltitudeM)) {
+        fixedwing.setAbsoluteAltitudeM(absoluteAltitudeM);
+        changed = true;
+    }
+
+    if (changed) {
+        m_fields |= QAutopilotTelemetryChanges::Fixedwing;
+    }
+}
@@ -0,0 +1,176 @@
+#ifndef QAUTOPILOTTELEMETRYREDUCER_H
+#define QAUTOPILOTTELEMETRYREDUCER_H
+
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include "Common/QGpsPosition.h"
+#include "Common/QNEDPosition.h"
+#include "Common/QAttitude.h"
+#include "Common/QVelocity.h"
+#include "Common/QRawGps.h"
+#include "Plat/QAutopilotStatus.h"
+#include "Plat/QAutopilotFixedwing.h"
+
+class QGCSConfig;
+
+/**
+ * @brief 移动状态判定阈值
+ *
+ * 在拥有者线程从配置读取后按值传递，归并线程不访问 QSettings。
+ */
+struct QAutopilotMotionThresholds
+{
+    double startHorizontalSpeedMS{0.7};
+    double startVerticalSpeedMS{0.5};
+    double stopHorizontalSpeedMS{0.25};
+    double stopVerticalSpeedMS{0.2};
+    int startSampleCount{2};
+    int stopSampleCount{5};
+
+    static QAutopilotMotionThresholds fromConfig(const QGCSConfig *config);
+};
+
+/**
+ * @brief 移动判定的连续样本计数
+ */
+struct QAutopilotMotionSamples
+{
+    int startCount{0}; ///< 连续满足开始移动条件的样本数
+    int stopCount{0};  ///< 连续满足停止移动条件的样本数
+};
+
+/**
+ * @brief 按原始速度样本统计移动判定的连续计数
+ *
+ * 在 MAVSDK 回调线程对每个样本调用 sample()，计数先于合并刷新完成，
+ * Motion/StartSampleCount 与 Motion/StopSampleCount 因此仍按遥测样本计，
+ * 与 Telemetry/FlushIntervalMs 无关。单写者；load() 可在任意线程调用。
+ */
+class QAutopilotMotionCounter
+{
+public:
+    /**
+     * @brief 设置速度阈值；须在开始调用 sample() 之前设置
+     */
+    void setThresholds(const QAutopilotMotionThresholds &thresholds);
+
+    void sample(float velocityNorth, float velocityEast, float velocityDown,
+                bool inAir);
+    QAutopilotMotionSamples load() const;
+
+private:
+    QAutopilotMotionThresholds m_thresholds;
+    /// 低 32 位为开始计数，高 32 位为停止计数，一次读取两者一致
+    std::atomic<quint64> m_counts{0};
+};
+
+/**
+ * @brief 高频遥测归并后的业务状态
+ */
+struct QAutopilotTelemetryState
+{
+    QGpsPosition gpsPosition;
+    bool hasGpsPosition{false};
+    double relativeAltitudeM{0.0};
+    QNEDPosition nedPosition;
+    QGpsPosition homePosition;
+    QAutopilotStatus status;
+    QAutopilotFixedwing fixedwing;
+    QAttitude attitude;
+    QVelocity velocity;
+    QRawGps rawGps;
+    bool moving{false};
+    bool inAir{false};
+};
+
+/**
+ * @brief 一次归并产生的变化集合
+ */
+struct QAutopilotTelemetryChanges
+{
+    enum Field : quint32 {
+        HasGpsPosition = 1u << 0,
+        GpsPosition = 1u << 1,
+        PositionDetails = 1u << 2,
+        NedPosition = 1u << 3,
+        HomePosition = 1u << 4,
+        Status = 1u << 5,
+        Fixedwing = 1u << 6,
+        Attitude = 1u << 7,
+        Velocity = 1u << 8,
+        RawGps = 1u << 9,
+        Moving = 1u << 10
+    };
+
+    /// QTelemetryStream 的流数
+    static constexpr std::size_t StreamCount = 12;
+
+    quint32 fields{0};
+    QAutopilotTelemetryState state;
+    /// 按 QTelemetryStream 位序：本次归并取用的最早样本到达时间
+    /// （单调时钟纳秒），0 表示该流本次没有样本
+    std::array<qint64, StreamCount> sampleTimeNs{};
+
+    bool isEmpty() const { return fields == 0; }
+    bool has(Field field) const { return (fields & field) != 0; }
+};
+
+/**
+ * @brief 与线程无关的遥测去重与移动状态判定
+ *
+ * 每个输入与 QAutopilot 原有槽的语义一致；只记录发生变化的字段，
+ * 由 takeChanges() 一次性取出。实例只能在单个线程上使用。
+ */
+class QAutopilotTelemetryReducer
+{
+public:
+    void reset(const QAutopilotTelemetryState &state);
+    void setMotionThresholds(const QAutopilotMotionThresholds &thresholds);
+
+    /**
+     * @brief 取出自上次调用以来的变化
+     */
+    QAutopilotTelemetryChanges takeChanges();
+
+    void position(double dLon, double dLat, float dH,
+                  float relativeAltitudeM);
+    void ned(float dNorth, float dEast, float dDown,
+             float velocityNorth, float velocityEast, float velocityDown);
+    void inAir(bool inAir);
+    /**
+     * @brief 应用 QAutopilotMotionCounter 统计的连续样本数
+     */
+    void motion(const QAutopilotMotionSamples &samples);
+    void gpsInfo(int gpsCount, int gpsStatus);
+    void battery(int batteryId, float temperatureC, float batteryVoltage,
+                 float batteryCurrentA, float consumedAh,
+                 float batteryRemaining, float timeRemainingS,
+                 int batteryFunction);
+    void attitude(float rollDeg, float pitchDeg, float yawDeg);
+    void heading(double heading);
+    void rawGps(float hdop, float vdop, float velocityMS, float courseDeg,
+                float horizontalUncertaintyM, float verticalUncertaintyM,
+                float velocityUncertaintyMS, float headingUncertaintyDeg);
+    void rcStatus(bool isAvailable, float signalStrengthPercent);
+    void health(bool isGyrometerCalibrationOk,
+                bool isAccelerometerCalibrationOk,
+                bool isMagnetometerCalibrationOk, bool isLocalPositionOk,
+                bool isGlobalPositionOk, bool isHomePositionOk,
+                bool isArmable);
+    void home(double dLon, double dLat, float dH);
+    void fixedwing(float airspeedMS, float throttlePercentage,
+                   float climbRateMS, float groundspeedMS, float headingDeg,
+                   float absoluteAltitudeM);
+
+private:
+    void updateMovingState();
+
+    QAutopilotTelemetryState m_state;
+    QAutopilotMotionThresholds m_thresholds;
+    quint32 m_fields{0};
+    QAutopilotMotionSamples m_motionSamples;
+};
+
+#endif // QAUTOPILOTTELEMETRYREDUCER_H
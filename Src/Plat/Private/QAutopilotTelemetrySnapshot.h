@@ -0,0 +1,156 @@
+#ifndef QAUTOPILOTTELEMETRYSNAPSHOT_H
+#define QAUTOPILOTTELEMETRYSNAPSHOT_H
+
+#include <QElapsedTimer>
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+#include <mavsdk/plugins/telemetry/telemetry.h>
+#include "QAutopilotTelemetryReducer.h"
+
+class QObject;
+
+/**
+ * @brief 遥测流标识（位掩码）
+ */
+enum QTelemetryStream : quint32 {
+    TelemetryPosition = 1u << 0,
+    TelemetryHeading = 1u << 1,
+    TelemetryBattery = 1u << 2,
+    TelemetryRawGps = 1u << 3,
+    TelemetryAttitude = 1u << 4,
+    TelemetryPositionVelocityNed = 1u << 5,
+    TelemetryHealth = 1u << 6,
+    TelemetryGpsInfo = 1u << 7,
+    TelemetryHome = 1u << 8,
+    TelemetryRcStatus = 1u << 9,
+    TelemetryFixedwingMetrics = 1u << 10,
+    TelemetryInAir = 1u << 11
+};
+static_assert(TelemetryInAir ==
+                  1u << (QAutopilotTelemetryChanges::StreamCount - 1),
+              "QAutopilotTelemetryChanges::StreamCount must cover every stream");
+
+/**
+ * @brief 单写多读的「最新值」槽（seqlock）
+ *
+ * MAVSDK 回调线程覆盖写入，拥有者线程在合并刷新时读取；写入不阻塞、
+ * 不分配内存，读取在写入交错时重试。
+ */
+template<typename T>
+class QTelemetrySlot
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "QTelemetrySlot requires a trivially copyable sample");
+
+public:
+    void store(const T &value)
+    {
+        unsigned sequence = m_sequence.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((sequence & 1u) == 0 &&
+                m_sequence.compare_exchange_weak(
+                    sequence, sequence + 1, std::memory_order_relaxed)) {
+                break;
+            }
+            sequence = m_sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&m_value, &value, sizeof(T));
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    T load() const
+    {
+        T value;
+        for (;;) {
+            const unsigned before = m_sequence.load(std::memory_order_acquire);
+            if ((before & 1u) != 0) {
+                continue;
+            }
+            std::memcpy(&value, &m_value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == before) {
+                return value;
+            }
+        }
+    }
+
+private:
+    std::atomic<unsigned> m_sequence{0};
+    T m_value{};
+};
+
+/**
+ * @brief 单机遥测快照
+ *
+ * MAVSDK 线程只写入最新值并置脏位；首个脏位负责投递一次合并刷新，
+ * 归并线程按帧间隔把所有脏字段交给 reducer 去重，再把变化集合一次性
+ * 应用到 QAutopilot。未启用工作线程时归并线程即 QAutopilot 所在线程。
+ */
+struct QAutopilotTelemetrySnapshot
+{
+    QTelemetrySlot<mavsdk::Telemetry::Position> position;
+    QTelemetrySlot<mavsdk::Telemetry::Heading> heading;
+    QTelemetrySlot<mavsdk::Telemetry::Battery> battery;
+    QTelemetrySlot<mavsdk::Telemetry::RawGps> rawGps;
+    QTelemetrySlot<mavsdk::Telemetry::EulerAngle> attitude;
+    QTelemetrySlot<mavsdk::Telemetry::PositionVelocityNed> positionVelocityNed;
+    QTelemetrySlot<mavsdk::Telemetry::Health> health;
+    QTelemetrySlot<mavsdk::Telemetry::GpsInfo> gpsInfo;
+    QTelemetrySlot<mavsdk::Telemetry::Position> home;
+    QTelemetrySlot<mavsdk::Telemetry::RcStatus> rcStatus;
+    QTelemetrySlot<mavsdk::Telemetry::FixedwingMetrics> fixedwingMetrics;
+
+    std::atomic_bool inAir{false};
+    /// 在 MAVSDK 线程逐个速度样本计数；阈值在订阅前设置
+    QAutopilotMotionCounter motion;
+
+    std::atomic<quint32> dirty{0};
+    /// 按流位序：尚未刷新的最早样本到达时间（单调时钟纳秒），0 表示无
+    std::array<std::atomic<qint64>, QAutopilotTelemetryChanges::StreamCount>
+        sampleTimeNs{};
+    std::atomic_bool flushPending{false};
+    std::atomic_bool active{true};
+
+    /// 归并所在的工作线程上下文，为空时在 QAutopilot 所在线程归并；订阅前设置
+    QObject *worker{nullptr};
+
+    /// 以下仅在归并线程访问
+    int flushIntervalMs{0};
+    QElapsedTimer lastFlush;
+    QAutopilotTelemetryReducer reducer;
+
+    /// 单调时钟纳秒，与 sampleTimeNs 同一时基
+    static qint64 monotonicNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /// 记录样本到达时间；同一流在刷新前只保留最早的一次
+    void stampSample(quint32 stream)
+    {
+        const int index = std::countr_zero(stream);
+        qint64 expected = 0;
+        sampleTimeNs[static_cast<std::size_t>(index)].compare_exchange_strong(
+            expected, monotonicNs(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 标记脏字段
+     * @return true 表示调用方需要投递一次刷新
+     */
+    bool markDirty(quint32 streams)
+    {
+        dirty.fetch_or(streams);
+        return !flushPending.exchange(true);
+    }
+};
+
+#endif // QAUTOPILOTTELEMETRYSNAPSHOT_H
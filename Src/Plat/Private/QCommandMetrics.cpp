@@ -0,0 +1,129 @@
+#include "Plat/Private/QCommandMetrics.h"
+#include "Plat/Private/QMavlinkMessageCounters.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+uint64_t commandTransmissions(const QCommandAttempt &attempt)
+{
+    const QMavlinkMessageCounters *counters =
+        attempt.stats ? attempt.stats->system(attempt.systemId) : nullptr;
+    return counters ? counters->commandTransmissions(attempt.mavCommand) : 0;
+}
+} // namespace
+
+QCommandAttempt QCommandAttempt::begin(
+    const QString &name, uint16_t mavCommand, uint8_t systemId,
+    const std::shared_ptr<QMavlinkMessageStats> &stats)
+{
+    QCommandAttempt attempt;
+    attempt.name = name;
+    attempt.mavCommand = mavCommand;
+    attempt.systemId = systemId;
+    attempt.stats = stats;
+    attempt.transmissionsBefore = commandTransmissions(attempt);
+    attempt.sentUs = nowUs();
+    return attempt;
+}
+
+void QCommandAttempt::finish(int64_t ackUs)
+{
+    latencyUs = std::max<int64_t>(0, ackUs - sentUs);
+    /// 首次发送之外的同一 MAV_CMD 帧都算重发；并发命令由 QCommandMetrics 排除
+    const uint64_t transmissions = commandTransmissions(*this);
+    retries = transmissions > transmissionsBefore + 1
+        ? static_cast<uint32_t>(transmissions - transmissionsBefore - 1)
+        : 0;
+}
+
+int64_t QCommandAttempt::nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void QCommandMetrics::recordSent(QCommandAttempt &attempt)
+{
+    ++command(attempt.name).sent;
+    InFlight &flight = inFlight(attempt.mavCommand);
+    if (flight.count > 0) {
+        attempt.overlapped = true;
+        ++flight.overlapSerial;
+    }
+    attempt.overlapSerial = flight.overlapSerial;
+    ++flight.count;
+}
+
+void QCommandMetrics::recordFinished(const QCommandAttempt &attempt,
+                                     Outcome outcome)
+{
+    Command &entry = command(attempt.name);
+    InFlight &flight = inFlight(attempt.mavCommand);
+    const bool overlapped = attempt.overlapped ||
+                            flight.overlapSerial != attempt.overlapSerial;
+    if (flight.count > 0) {
+        --flight.count;
+    }
+    if (!overlapped) {
+        entry.retries += attempt.retries;
+    }
+    switch (outcome) {
+    case Outcome::Accepted:
+        ++entry.accepted;
+        break;
+    case Outcome::Rejected:
+        ++entry.rejected;
+        break;
+    case Outcome::TimedOut:
+        ++entry.timedOut;
+        return;
+    case Outcome::Failed:
+        ++entry.failed;
+        return;
+    }
+    if (attempt.latencyUs >= 0) {
+        entry.latency.record(attempt.latencyUs);
+    }
+}
+
+void QCommandMetrics::clearInFlight()
+{
+    /// 旧飞控上仍未返回的命令结束时序号不符，按并发处理
+    for (InFlight &flight : m_inFlight) {
+        flight.count = 0;
+        ++flight.overlapSerial;
+    }
+}
+
+void QCommandMetrics::reset()
+{
+    m_commands.clear();
+}
+
+QCommandMetrics::Command &QCommandMetrics::command(const QString &name)
+{
+    const auto found = std::find_if(
+        m_commands.begin(), m_commands.end(),
+        [&name](const Command &entry) { return entry.name == name; });
+    if (found != m_commands.end()) {
+        return *found;
+    }
+    m_commands.push_back(Command{name});
+    return m_commands.back();
+}
+
+QCommandMetrics::InFlight &QCommandMetrics::inFlight(uint16_t mavCommand)
+{
+    const auto found = std::find_if(
+        m_inFlight.begin(), m_inFlight.end(),
+        [mavCommand](const InFlight &entry) {
+            return entry.mavCommand == mavCommand;
+        });
+    if (found != m_inFlight.end()) {
+        return *found;
+    }
+    m_inFlight.push_back(InFlight{mavCommand});
+    return m_inFlight.back();
+}
@@ -0,0 +1,105 @@
+#ifndef QCOMMANDMETRICS_H
+#define QCOMMANDMETRICS_H
+
+#include <QString>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Private/QLatencyHistogram.h"
+
+class QMavlinkMessageStats;
+
+/**
+ * @brief 一次命令发送的计时与重发基准
+ *
+ * 在拥有者线程发出命令时创建，随结果回调在接收线程调用 finish()
+ * 记下应答时间与发送帧数之差，再投递回拥有者线程计入 QCommandMetrics。
+ */
+struct QCommandAttempt
+{
+    QString name;
+    uint16_t mavCommand{0};
+    uint8_t systemId{0};
+    std::shared_ptr<QMavlinkMessageStats> stats; ///< 整站命令发送计数
+    int64_t sentUs{0};
+    uint64_t transmissionsBefore{0};
+    int64_t latencyUs{-1}; ///< finish() 前为 -1
+    uint32_t retries{0};
+    /// 由 QCommandMetrics::recordSent() 填写，用于识别同一 MAV_CMD 的并发命令
+    uint64_t overlapSerial{0};
+    bool overlapped{false};
+
+    static QCommandAttempt begin(
+        const QString &name, uint16_t mavCommand, uint8_t systemId,
+        const std::shared_ptr<QMavlinkMessageStats> &stats);
+
+    /**
+     * @brief 收到结果时调用
+     * @param ackUs 应答到达的单调时间（微秒）
+     */
+    void finish(int64_t ackUs = nowUs());
+
+    static int64_t nowUs();
+};
+
+/**
+ * @brief 单机按命令名的往返统计
+ *
+ * 只在拥有者线程访问；命令种类很少，线性查找即可。
+ */
+class QCommandMetrics
+{
+public:
+    enum class Outcome {
+        Accepted,
+        Rejected, ///< 飞控应答拒绝或执行失败
+        TimedOut,
+        Failed    ///< 未能发出
+    };
+
+    struct Command
+    {
+        QString name;
+        uint64_t sent{0};
+        uint64_t accepted{0};
+        uint64_t rejected{0};
+        uint64_t timedOut{0};
+        uint64_t failed{0};
+        uint64_t retries{0};
+        QLatencyHistogram latency; ///< 仅含收到应答的命令
+    };
+
+    /**
+     * @brief 登记一次发出的命令
+     *
+     * 重发次数按同一 MAV_CMD 的发送帧数推算，无法区分帧属于哪次命令；
+     * 与同一 MAV_CMD 仍在等待结果的命令重叠时，双方都不计入 retries。
+     */
+    void recordSent(QCommandAttempt &attempt);
+    void recordFinished(const QCommandAttempt &attempt, Outcome outcome);
+
+    /**
+     * @brief 换绑飞控后丢弃未完成命令的并发登记
+     */
+    void clearInFlight();
+
+    const std::vector<Command> &commands() const { return m_commands; }
+    void reset();
+
+private:
+    /// 同一 MAV_CMD 等待结果的命令数；开始时已有命令在途则递增 overlapSerial
+    struct InFlight
+    {
+        uint16_t mavCommand{0};
+        int count{0};
+        uint64_t overlapSerial{0};
+    };
+
+    Command &command(const QString &name);
+    InFlight &inFlight(uint16_t mavCommand);
+
+    std::vector<Command> m_commands;
+    std::vector<InFlight> m_inFlight;
+};
+
+#endif // QCOMMANDMETRICS_H
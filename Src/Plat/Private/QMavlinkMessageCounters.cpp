@@ -0,0 +1,210 @@
+#include "Plat/Private/QMavlinkMessageCounters.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+constexpr uint16_t SequenceValid = 1u << 8;
+} // namespace
+
+QMavlinkMessageCounters::Slot *QMavlinkMessageCounters::slotFor(
+    uint32_t messageId)
+{
+    std::size_t index = (messageId * 2654435761u) % MessageSlots;
+    for (std::size_t probe = 0; probe < MessageSlots; ++probe) {
+        Slot &slot = m_slots[index];
+        uint32_t current = slot.messageId.load(std::memory_order_acquire);
+        if (current == messageId) {
+            return &slot;
+        }
+        if (current == EmptySlot &&
+            slot.messageId.compare_exchange_strong(
+                current, messageId, std::memory_order_acq_rel)) {
+            return &slot;
+        }
+        /// CAS 失败时 current 为其他线程写入的 ID
+        if (current == messageId) {
+            return &slot;
+        }
+        index = (index + 1) % MessageSlots;
+    }
+    return nullptr;
+}
+
+void QMavlinkMessageCounters::record(uint8_t componentId, uint32_t messageId,
+                                     uint8_t sequence,
+                                     std::size_t frameBytes, int64_t nowMs)
+{
+    m_packetsReceived.fetch_add(1, std::memory_order_relaxed);
+
+    const uint16_t previous = m_sequences[componentId].exchange(
+        static_cast<uint16_t>(SequenceValid | sequence),
+        std::memory_order_relaxed);
+    if (previous & SequenceValid) {
+        const uint8_t gap = static_cast<uint8_t>(
+            sequence - static_cast<uint8_t>(previous + 1));
+        if (gap != 0) {
+            m_packetsLost.fetch_add(gap, std::memory_order_relaxed);
+        }
+    }
+
+    Slot *slot = slotFor(messageId);
+    if (!slot) {
+        m_untrackedPackets.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    slot->packets.fetch_add(1, std::memory_order_relaxed);
+    slot->bytes.fetch_add(frameBytes, std::memory_order_relaxed);
+    slot->lastReceiveMs.store(nowMs, std::memory_order_relaxed);
+
+    /// 同一系统的消息通常只在一个接收线程上到达，窗口滚动不需要更强的同步
+    const int64_t windowStart =
+        slot->windowStartMs.load(std::memory_order_relaxed);
+    if (windowStart == 0) {
+        slot->windowStartMs.store(nowMs, std::memory_order_relaxed);
+    } else if (nowMs - windowStart >= RateWindowMs) {
+        const uint32_t packets =
+            slot->windowPackets.exchange(0, std::memory_order_relaxed);
+        slot->rateMilliHz.store(
+            static_cast<uint32_t>(packets * 1000000.0 / (nowMs - windowStart)),
+            std::memory_order_relaxed);
+        slot->windowStartMs.store(nowMs, std::memory_order_relaxed);
+    }
+    slot->windowPackets.fetch_add(1, std::memory_order_relaxed);
+}
+
+void QMavlinkMessageCounters::recordCommandSent(uint16_t command)
+{
+    std::size_t index = (command * 2654435761u) % CommandSlots;
+    for (std::size_t probe = 0; probe < CommandSlots; ++probe) {
+        CommandSlot &slot = m_commands[index];
+        uint32_t current = slot.command.load(std::memory_order_acquire);
+        if (current == EmptySlot &&
+            slot.command.compare_exchange_strong(
+                current, command, std::memory_order_acq_rel)) {
+            current = command;
+        }
+        /// CAS 失败时 current 为其他线程写入的命令
+        if (current == command) {
+            slot.transmissions.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        index = (index + 1) % CommandSlots;
+    }
+}
+
+uint64_t QMavlinkMessageCounters::commandTransmissions(uint16_t command) const
+{
+    std::size_t index = (command * 2654435761u) % CommandSlots;
+    for (std::size_t probe = 0; probe < CommandSlots; ++probe) {
+        const CommandSlot &slot = m_commands[index];
+        const uint32_t current = slot.command.load(std::memory_order_acquire);
+        if (current == command) {
+            return slot.transmissions.load(std::memory_order_relaxed);
+        }
+        if (current == EmptySlot) {
+            return 0;
+        }
+        index = (index + 1) % CommandSlots;
+    }
+    return 0;
+}
+
+std::vector<QMavlinkMessageCounters::Message>
+QMavlinkMessageCounters::messages(int64_t nowMs) const
+{
+    std::vector<Message> result;
+    for (const Slot &slot : m_slots) {
+        const uint32_t messageId = slot.messageId.load(std::memory_order_acquire);
+        const uint64_t packets = slot.packets.load(std::memory_order_relaxed);
+        if (messageId == EmptySlot || packets == 0) {
+            continue;
+        }
+        Message message;
+        message.messageId = messageId;
+        message.packets = packets;
+        message.bytes = slot.bytes.load(std::memory_order_relaxed);
+        message.lastReceiveMs =
+            slot.lastReceiveMs.load(std::memory_order_relaxed);
+
+        const int64_t windowStart =
+            slot.windowStartMs.load(std::memory_order_relaxed);
+        const int64_t elapsed = nowMs - windowStart;
+        if (elapsed >= 2 * RateWindowMs) {
+            /// 窗口早已过期：按过期窗口内的包数折算，停发后速率逐步归零
+            message.rateHz =
+                slot.windowPackets.load(std::memory_order_relaxed) * 1000.0 /
+                elapsed;
+        } else {
+            message.rateHz =
+                slot.rateMilliHz.load(std::memory_order_relaxed) / 1000.0;
+        }
+        result.push_back(message);
+    }
+    std::sort(result.begin(), result.end(),
+              [](const Message &left, const Message &right) {
+                  return left.messageId < right.messageId;
+              });
+    return result;
+}
+
+void QMavlinkMessageCounters::reset()
+{
+    for (Slot &slot : m_slots) {
+        slot.packets.store(0, std::memory_order_relaxed);
+        slot.bytes.store(0, std::memory_order_relaxed);
+        slot.windowStartMs.store(0, std::memory_order_relaxed);
+        slot.windowPackets.store(0, std::memory_order_relaxed);
+        slot.rateMilliHz.store(0, std::memory_order_relaxed);
+    }
+    for (std::atomic<uint16_t> &sequence : m_sequences) {
+        sequence.store(0, std::memory_order_relaxed);
+    }
+    for (CommandSlot &slot : m_commands) {
+        slot.transmissions.store(0, std::memory_order_relaxed);
+    }
+    m_packetsReceived.store(0, std::memory_order_relaxed);
+    m_packetsLost.store(0, std::memory_order_relaxed);
+    m_untrackedPackets.store(0, std::memory_order_relaxed);
+}
+
+int64_t QMavlinkMessageStats::nowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+void QMavlinkMessageStats::record(uint8_t systemId, uint8_t componentId,
+                                  uint32_t messageId, uint8_t sequence,
+                                  std::size_t frameBytes)
+{
+    systemCounters(systemId).record(componentId, messageId, sequence,
+                                    frameBytes, nowMs());
+}
+
+void QMavlinkMessageStats::recordCommandSent(uint8_t targetSystemId,
+                                             uint16_t command)
+{
+    if (targetSystemId == 0) {
+        return;
+    }
+    systemCounters(targetSystemId).recordCommandSent(command);
+}
+
+QMavlinkMessageCounters &QMavlinkMessageStats::systemCounters(uint8_t systemId)
+{
+    if (QMavlinkMessageCounters *counters =
+            m_systems[systemId].load(std::memory_order_acquire)) {
+        return *counters;
+    }
+    std::scoped_lock lock(m_mutex);
+    if (QMavlinkMessageCounters *counters =
+            m_systems[systemId].load(std::memory_order_acquire)) {
+        return *counters;
+    }
+    m_storage.push_back(std::make_unique<QMavlinkMessageCounters>());
+    QMavlinkMessageCounters *counters = m_storage.back().get();
+    m_systems[systemId].store(counters, std::memory_order_release);
+    return *counters;
+}
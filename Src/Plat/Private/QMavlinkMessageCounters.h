@@ -0,0 +1,144 @@
+#ifndef QMAVLINKMESSAGECOUNTERS_H
+#define QMAVLINKMESSAGECOUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief 单个系统按消息 ID 的接收计数
+ *
+ * 固定大小的开放寻址表，接收路径只做原子读写与一次 CAS 占位，
+ * 不加锁、不分配。速率按 1 秒窗口在接收路径上滚动计算，读取时
+ * 若窗口已过期则按过期窗口折算，停发的消息速率会逐步归零。
+ * 序号按组件跟踪，跳变计入该系统的丢包。另按 MAV_CMD 统计发往该系统的
+ * COMMAND_LONG / COMMAND_INT 次数，用于推算命令重发。
+ */
+class QMavlinkMessageCounters
+{
+public:
+    /// 每个系统最多跟踪的消息 ID 数，超出的计入 untrackedPackets
+    static constexpr std::size_t MessageSlots = 256;
+    static constexpr int64_t RateWindowMs = 1000;
+    /// 每个系统最多跟踪的 MAV_CMD 数
+    static constexpr std::size_t CommandSlots = 32;
+
+    struct Message
+    {
+        uint32_t messageId{0};
+        uint64_t packets{0};
+        uint64_t bytes{0};
+        double rateHz{0.0};
+        int64_t lastReceiveMs{0}; ///< 自纪元起毫秒
+    };
+
+    /**
+     * @brief 记录一个接收包（MAVSDK 接收线程）
+     */
+    void record(uint8_t componentId, uint32_t messageId, uint8_t sequence,
+                std::size_t frameBytes, int64_t nowMs);
+
+    /**
+     * @brief 已收到的消息，按消息 ID 升序
+     */
+    std::vector<Message> messages(int64_t nowMs) const;
+
+    uint64_t packetsReceived() const
+    {
+        return m_packetsReceived.load(std::memory_order_relaxed);
+    }
+    uint64_t packetsLost() const
+    {
+        return m_packetsLost.load(std::memory_order_relaxed);
+    }
+    uint64_t untrackedPackets() const
+    {
+        return m_untrackedPackets.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 记录一次发往该系统的命令帧（MAVSDK 发送线程）
+     */
+    void recordCommandSent(uint16_t command);
+
+    /**
+     * @brief 该 MAV_CMD 累计发送次数（含重发）
+     */
+    uint64_t commandTransmissions(uint16_t command) const;
+
+    /**
+     * @brief 清零计数；已占用的消息 ID 槽位保留
+     */
+    void reset();
+
+private:
+    static constexpr uint32_t EmptySlot = 0xFFFFFFFFu;
+
+    struct Slot
+    {
+        std::atomic<uint32_t> messageId{EmptySlot};
+        std::atomic<uint64_t> packets{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<int64_t> lastReceiveMs{0};
+        std::atomic<int64_t> windowStartMs{0};
+        std::atomic<uint32_t> windowPackets{0};
+        std::atomic<uint32_t> rateMilliHz{0};
+    };
+
+    struct CommandSlot
+    {
+        std::atomic<uint32_t> command{EmptySlot};
+        std::atomic<uint64_t> transmissions{0};
+    };
+
+    Slot *slotFor(uint32_t messageId);
+
+    std::array<Slot, MessageSlots> m_slots;
+    std::array<CommandSlot, CommandSlots> m_commands;
+    /// 每组件：bit8 有效位 | 上一个序号
+    std::array<std::atomic<uint16_t>, 256> m_sequences{};
+    std::atomic<uint64_t> m_packetsReceived{0};
+    std::atomic<uint64_t> m_packetsLost{0};
+    std::atomic<uint64_t> m_untrackedPackets{0};
+};
+
+/**
+ * @brief 整站按系统 ID 索引的消息计数
+ *
+ * 各系统的计数在首次收到其消息时创建，之后保留到整站销毁，
+ * 接收路径上查找只是一次原子指针读取。
+ */
+class QMavlinkMessageStats
+{
+public:
+    void record(uint8_t systemId, uint8_t componentId, uint32_t messageId,
+                uint8_t sequence, std::size_t frameBytes);
+
+    /**
+     * @brief 记录一次发出的 COMMAND_LONG / COMMAND_INT；广播目标不计
+     */
+    void recordCommandSent(uint8_t targetSystemId, uint16_t command);
+
+    /**
+     * @brief 指定系统的计数；尚未收到该系统的消息时返回 nullptr
+     */
+    QMavlinkMessageCounters *system(uint8_t systemId) const
+    {
+        return m_systems[systemId].load(std::memory_order_acquire);
+    }
+
+    static int64_t nowMs();
+
+private:
+    QMavlinkMessageCounters &systemCounters(uint8_t systemId);
+
+    std::array<std::atomic<QMavlinkMessageCounters *>, 256> m_systems{};
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<QMavlinkMessageCounters>> m_storage;
+};
+
+#endif // QMAVLINKMESSAGECOUNTERS_H
@@ -4,8 +4,10 @@
 #include "Plat/QAutopilot.h"
 #include "Plat/QAutoVehicleType.h"
 
+#include <cmath>
 #include <mavsdk/autopilot.h>
 #include <mavsdk/vehicle.h>
+#include <mavsdk/plugins/mission/mission.h>
 #include <mavsdk/plugins/telemetry/telemetry.h>
 
 namespace MavsdkTypeMap {
@@ -140,6 +142,73 @@ inline QAutoVehicleType::Vehicle toVehicle(mavsdk::Vehicle type)
     }
 }
 
+inline QMissionPoint missionPointFromMavsdk(
+    const mavsdk::Mission::MissionItem &item)
+{
+    QMissionPoint::Action action = QMissionPoint::ContinueAction;
+    double durationS = 0.0;
+    if (item.vehicle_action ==
+        mavsdk::Mission::MissionItem::VehicleAction::Land) {
+        action = QMissionPoint::LandAction;
+    } else if (item.camera_action ==
+               mavsdk::Mission::MissionItem::CameraAction::TakePhoto) {
+        action = QMissionPoint::TakePhotoAction;
+    } else if (item.camera_action ==
+               mavsdk::Mission::MissionItem::CameraAction::StartVideo) {
+        action = QMissionPoint::RecordVideoAction;
+        durationS = std::isfinite(item.loiter_time_s)
+            ? item.loiter_time_s : 0.0;
+    } else if (std::isfinite(item.loiter_time_s) &&
+               item.loiter_time_s > 0.0f) {
+        action = QMissionPoint::WaitAction;
+        durationS = item.loiter_time_s;
+    }
+
+    const double speedMS = std::isfinite(item.speed_m_s)
+        ? item.speed_m_s : 0.0;
+    return QMissionPoint(
+        QGpsPosition(item.longitude_deg, item.latitude_deg,
+                     item.relative_altitude_m),
+        action, durationS, speedMS, item.is_fly_through);
+}
+
+inline mavsdk::Mission::MissionItem mavsdkItemFromMissionPoint(
+    const QMissionPoint &point)
+{
+    mavsdk::Mission::MissionItem item;
+    const QGpsPosition position = point.position();
+    item.latitude_deg = position.latitude();
+    item.longitude_deg = position.longitude();
+    item.relative_altitude_m = position.altitude();
+    item.is_fly_through = point.flyThrough();
+    if (point.speedMS() > 0.0) {
+        item.speed_m_s = static_cast<float>(point.speedMS());
+    }
+
+    switch (point.action()) {
+    case QMissionPoint::ContinueAction:
+        item.is_fly_through = true;
+        break;
+    case QMissionPoint::WaitAction:
+        item.loiter_time_s = static_cast<float>(point.actionDurationS());
+        break;
+    case QMissionPoint::TakePhotoAction:
+        item.camera_action =
+            mavsdk::Mission::MissionItem::CameraAction::TakePhoto;
+        break;
+    case QMissionPoint::RecordVideoAction:
+        item.camera_action =
+            mavsdk::Mission::MissionItem::CameraAction::StartVideo;
+        item.loiter_time_s = static_cast<float>(point.actionDurationS());
+        break;
+    case QMissionPoint::LandAction:
+        item.vehicle_action =
+            mavsdk::Mission::MissionItem::VehicleAction::Land;
+        break;
+    }
+    return item;
+}
+
 } // namespace MavsdkTypeMap
 
 #endif // QMAVSDKTYPEMAP_H
@@ -0,0 +1,38 @@
+#include "Plat/Private/QMessageSubscription.h"
+
+#include <chrono>
+#include <cmath>
+
+QMessageRateLimiter::QMessageRateLimiter(double maxRateHz)
+{
+    if (maxRateHz > 0.0 && std::isfinite(maxRateHz)) {
+        m_intervalUs = static_cast<int64_t>(std::llround(1e6 / maxRateHz));
+    }
+}
+
+bool QMessageRateLimiter::admit(int64_t nowUs)
+{
+    if (m_intervalUs <= 0) {
+        return true;
+    }
+    int64_t next = m_nextUs.load(std::memory_order_relaxed);
+    for (;;) {
+        if (nowUs < next) {
+            return false;
+        }
+        const int64_t following = nowUs - next < m_intervalUs
+                                      ? next + m_intervalUs
+                                      : nowUs + m_intervalUs;
+        if (m_nextUs.compare_exchange_weak(next, following,
+                                           std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+int64_t QMessageRateLimiter::nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
@@ -0,0 +1,56 @@
+#ifndef QMESSAGESUBSCRIPTION_H
+#define QMESSAGESUBSCRIPTION_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Extern/XmlToMavSDK.h"
+
+/**
+ * @brief 单个订阅的限频器
+ *
+ * 在 MAVSDK 接收线程上于解码与跨线程投递之前调用。按固定间隔放行：
+ * 准时到达的消息沿用上一次的排期，保持平均频率不超过上限；
+ * 中断后重新到达的消息从当前时刻重新排期，不会积攒成突发。
+ */
+class QMessageRateLimiter
+{
+public:
+    explicit QMessageRateLimiter(double maxRateHz);
+
+    /**
+     * @brief 是否放行一条消息；可在多个线程并发调用
+     * @param nowUs 单调时间（微秒）
+     */
+    bool admit(int64_t nowUs = QMessageRateLimiter::nowUs());
+
+    static int64_t nowUs();
+
+private:
+    int64_t m_intervalUs{0};
+    std::atomic<int64_t> m_nextUs{0};
+};
+
+/**
+ * @brief QPlat::subscribeMessage() 创建的一个订阅
+ *
+ * 布局与限频器在订阅期间不变，重新绑定 System 时原样挂到新的接收回调上。
+ */
+struct QMessageSubscription
+{
+    int id{0};
+    std::shared_ptr<const XmlToMavSDK::MessageSchema> schema;
+    std::shared_ptr<QMessageRateLimiter> limiter; ///< 不限频时为 nullptr
+};
+
+/**
+ * @brief QPlat 持有的订阅列表，拥有者线程访问
+ */
+struct QMessageSubscriptions
+{
+    std::vector<QMessageSubscription> items;
+    int nextId{1};
+};
+
+#endif // QMESSAGESUBSCRIPTION_H
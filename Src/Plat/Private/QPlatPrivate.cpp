@@ -1,28 +1,42 @@
 #include <QDebug>
 #include <QPointer>
 #include <QThreadPool>
+#include <algorithm>
 #include <sstream>
 #include <utility>
-#include <QJsonDocument>
-#include <QJsonObject>
 
 #include "Private/QGCSLog.h"
+#include "Private/QGCSJournal.h"
+#include "Private/QGCSTrace.h"
 #include "Private/QGCSConfigInternal.h"
 #include "Private/QMavsdkTextCatalog.h"
+#include "Private/QQueuedInvoke.h"
 #include "QGCSConfig.h"
 #include "Extern/XmlToMavSDK.h"
 #include "Plat/Private/QPlatPrivate.h"
+#include "Plat/Private/QMavlinkMessageCounters.h"
 #include "Plat/QPlat.h"
 
 QPlatPrivate::QPlatPrivate(QPlat *pPlat)
     : q_ptr(pPlat), m_infoState(std::make_shared<InfoState>()) {
 }
 
+QMavlinkMessageCounters *QPlatPrivate::messageCounters() const
+{
+    if (!m_messageStats || !q_ptr || q_ptr->vehicleId() < 0 ||
+        q_ptr->vehicleId() > 255) {
+        return nullptr;
+    }
+    return m_messageStats->system(static_cast<uint8_t>(q_ptr->vehicleId()));
+}
+
 QPlatPrivate::~QPlatPrivate()
 {
     m_infoState->active = false;
-    if (m_pMavlinkDirect && m_statusTextHandle.valid()) {
-        m_pMavlinkDirect->unsubscribe_message(m_statusTextHandle);
+    unsubscribeMessages();
+    if (m_pMavlinkPassthrough && m_statusTextHandle.valid()) {
+        m_pMavlinkPassthrough->unsubscribe_message(MAVLINK_MSG_ID_STATUSTEXT,
+                                                   m_statusTextHandle);
         m_statusTextHandle = {};
     }
     if (m_pSystem) {
@@ -68,8 +82,10 @@ void QPlatPrivate::setSystem(std::shared_ptr<mavsdk::System> system) {
 
     /// 如果原来的system 不为空，取消订阅
     if (nullptr != m_pSystem) {
-        if (m_pMavlinkDirect && m_statusTextHandle.valid()) {
-            m_pMavlinkDirect->unsubscribe_message(m_statusTextHandle);
+        unsubscribeMessages();
+        if (m_pMavlinkPassthrough && m_statusTextHandle.valid()) {
+            m_pMavlinkPassthrough->unsubscribe_message(MAVLINK_MSG_ID_STATUSTEXT,
+                                                       m_statusTextHandle);
             m_statusTextHandle = {};
         }
         if (m_hConntecd.valid()) {
@@ -85,6 +101,7 @@ void QPlatPrivate::setSystem(std::shared_ptr<mavsdk::System> system) {
     if (!m_pSystem) {
         m_pInfo.reset();
         m_pMavlinkDirect.reset();
+        m_pMavlinkPassthrough.reset();
         return;
     }
 
@@ -93,34 +110,41 @@ void QPlatPrivate::setSystem(std::shared_ptr<mavsdk::System> system) {
         m_pSystem->enable_timesync();
     }
     // 创建插件实例
-    m_pInfo = std::make_shared<mavsdk::Info>(*system);
-    m_pMavlinkDirect = std::make_shared<mavsdk::MavlinkDirect>(*system);
+    {
+        QGCS_TRACE_SCOPE_ID("plugin", "constructPlatPlugins",
+                            system->get_system_id());
+        m_pInfo = std::make_shared<mavsdk::Info>(*system);
+        m_pMavlinkDirect = std::make_shared<mavsdk::MavlinkDirect>(*system);
+        m_pMavlinkPassthrough =
+            std::make_shared<mavsdk::MavlinkPassthrough>(*system);
+    }
 
     const QPointer<QPlat> plat(q_ptr);
     const uint32_t systemId = m_pSystem->get_system_id();
-    m_statusTextHandle = m_pMavlinkDirect->subscribe_message(
-        "STATUSTEXT", [plat, systemId](
-                          mavsdk::MavlinkDirect::MavlinkMessage msg) {
+    m_statusTextHandle = m_pMavlinkPassthrough->subscribe_message(
+        MAVLINK_MSG_ID_STATUSTEXT,
+        [plat, systemId](const mavlink_message_t &message) {
             if (!plat) {
                 return;
             }
-            std::string fieldsJson = std::move(msg.fields_json);
+            mavlink_statustext_t statusText;
+            mavlink_msg_statustext_decode(&message, &statusText);
+            /// text 写满 50 字节时没有结尾的 0
+            const QString text = QString::fromUtf8(
+                statusText.text,
+                static_cast<qsizetype>(
+                    qstrnlen(statusText.text, sizeof(statusText.text))));
+            const int severity = statusText.severity;
+            const uint8_t componentId = message.compid;
             QMetaObject::invokeMethod(
                 plat,
-                [plat, systemId, fieldsJson = std::move(fieldsJson)]() {
+                [plat, systemId, componentId, severity, text]() {
                     if (!plat) {
                         return;
                     }
-                    QJsonParseError error;
-                    const QJsonDocument document = QJsonDocument::fromJson(
-                        QByteArray::fromStdString(fieldsJson), &error);
-                    if (error.error != QJsonParseError::NoError ||
-                        !document.isObject()) {
-                        return;
-                    }
-                    const QJsonObject object = document.object();
-                    const int severity = object.value("severity").toInt();
-                    const QString text = object.value("text").toString();
+                    QGCSJournal::record(QJournalEvent::StatusText,
+                                        static_cast<uint8_t>(systemId),
+                                        severity, 0, componentId);
                     QGCSConfigInternal::handleFirmwareLog(
                         systemId, severity, text);
                     if (severity >= QGCSConfig::LogSeverityEmergency &&
@@ -130,6 +154,9 @@ void QPlatPrivate::setSystem(std::shared_ptr<mavsdk::System> system) {
                 },
                 Qt::QueuedConnection);
         });
+    for (AttachedSubscription &attached : m_messageSubscriptions) {
+        subscribeMessage(attached);
+    }
 
     // 通过 Info 插件获取版本信息
     // 扩展 XML 由 QGroundControlStationPrivate 整站注入一次，此处不再每机加载
@@ -204,10 +231,117 @@ void QPlatPrivate::syncConnectionStatus() const
         Qt::QueuedConnection);
 }
 
+void QPlatPrivate::attachMessageSubscription(
+    const QMessageSubscription &subscription)
+{
+    if (!subscription.schema) {
+        return;
+    }
+    AttachedSubscription &attached = m_messageSubscriptions.emplace_back();
+    attached.subscription = subscription;
+    subscribeMessage(attached);
+}
+
+void QPlatPrivate::detachMessageSubscription(int subscriptionId)
+{
+    const auto it = std::find_if(
+        m_messageSubscriptions.begin(), m_messageSubscriptions.end(),
+        [subscriptionId](const AttachedSubscription &attached) {
+            return attached.subscription.id == subscriptionId;
+        });
+    if (it == m_messageSubscriptions.end()) {
+        return;
+    }
+    unsubscribeMessage(*it);
+    m_messageSubscriptions.erase(it);
+}
+
+void QPlatPrivate::subscribeMessage(AttachedSubscription &attached)
+{
+    if (!m_pSystem || !m_pMavlinkPassthrough || !m_pMavlinkDirect) {
+        return;
+    }
+    const QPointer<QPlat> plat(q_ptr);
+    const int subscriptionId = attached.subscription.id;
+    const auto schema = attached.subscription.schema;
+    const auto limiter = attached.subscription.limiter;
+    attached.binary = mavlink_get_msg_entry(schema->id) != nullptr;
+
+    if (attached.binary) {
+        attached.passthroughHandle = m_pMavlinkPassthrough->subscribe_message(
+            static_cast<uint16_t>(schema->id),
+            [plat, subscriptionId, schema,
+             limiter](const mavlink_message_t &message) {
+                if (!plat || (limiter && !limiter->admit())) {
+                    return;
+                }
+                QMavlinkMessage decoded;
+                decoded.setName(schema->name);
+                decoded.setMessageId(static_cast<int>(schema->id));
+                decoded.setSystemId(message.sysid);
+                decoded.setComponentId(message.compid);
+                decoded.setFields(XmlToMavSDK::decodePayload(
+                    *schema,
+                    reinterpret_cast<const uint8_t *>(_MAV_PAYLOAD(&message)),
+                    message.len));
+                QQueuedInvoke::post(plat, &QPlat::messageReceived,
+                                    subscriptionId, std::move(decoded));
+            });
+        return;
+    }
+
+    attached.directHandle = m_pMavlinkDirect->subscribe_message(
+        schema->name.toStdString(),
+        [plat, subscriptionId, schema,
+         limiter](mavsdk::MavlinkDirect::MavlinkMessage message) {
+            if (!plat || (limiter && !limiter->admit())) {
+                return;
+            }
+            QMavlinkMessage decoded;
+            decoded.setName(schema->name);
+            decoded.setMessageId(static_cast<int>(schema->id));
+            decoded.setSystemId(static_cast<int>(message.system_id));
+            decoded.setComponentId(static_cast<int>(message.component_id));
+            decoded.setFields(
+                XmlToMavSDK::decodeFieldsJson(*schema, message.fields_json));
+            QQueuedInvoke::post(plat, &QPlat::messageReceived, subscriptionId,
+                                std::move(decoded));
+        });
+}
+
+void QPlatPrivate::unsubscribeMessage(AttachedSubscription &attached)
+{
+    if (m_pMavlinkPassthrough && attached.passthroughHandle.valid()) {
+        m_pMavlinkPassthrough->unsubscribe_message(
+            static_cast<uint16_t>(attached.subscription.schema->id),
+            attached.passthroughHandle);
+    }
+    if (m_pMavlinkDirect && attached.directHandle.valid()) {
+        m_pMavlinkDirect->unsubscribe_message(attached.directHandle);
+    }
+    attached.passthroughHandle = {};
+    attached.directHandle = {};
+}
+
+void QPlatPrivate::unsubscribeMessages()
+{
+    for (AttachedSubscription &attached : m_messageSubscriptions) {
+        unsubscribeMessage(attached);
+    }
+}
+
 template<>struct fmt::formatter<mavsdk::Info::Result>:ostream_formatter{};
 template<>struct fmt::formatter<mavsdk::Info::Version>:ostream_formatter{};
 template<>struct fmt::formatter<mavsdk::Info::Product>:ostream_formatter{};
 
+namespace {
+/// 事件日志中的版本号：major<<16 | minor<<8 | patch
+int32_t packedVersion(int major, int minor, int patch)
+{
+    return ((major & 0xFF) << 16) | ((minor & 0xFF) << 8) | (patch & 0xFF);
+}
+} // namespace
+
 void QPlatPrivate::updateVersionInfo() {
     if (!m_pInfo || !m_pSystem) {
         return;
@@ -234,6 +368,14 @@ void QPlatPrivate::updateVersionInfo() {
 
             spdlog::info(PLAT_FMT_STR, currentSystem->get_system_id(),
                          "version", version);
+            QGCSJournal::record(
+                QJournalEvent::FirmwareVersion,
+                currentSystem->get_system_id(),
+                packedVersion(version.flight_sw_major,
+                              version.flight_sw_minor,
+                              version.flight_sw_patch),
+                packedVersion(version.os_sw_major, version.os_sw_minor,
+                              version.os_sw_patch));
             
             softwareVersion =
                 QString("Flight SW: v%1.%2.%3 (Vendor v%4.%5.%6, git %7, %8)"
@@ -246,7 +388,7 @@ void QPlatPrivate::updateVersionInfo() {
                     .arg(version.flight_sw_vendor_patch)
                     .arg(QString::fromStdString(version.flight_sw_git_hash))
                     .arg(QMavsdkTextCatalog::text(
-                        QStringLiteral("flightSoftwareVersionType"),
+                        QMavsdkTextCatalog::FlightSoftwareVersionType,
                         static_cast<int>(version.flight_sw_version_type)))
                     .arg(version.os_sw_major)
                     .arg(version.os_sw_minor)
@@ -256,6 +398,9 @@ void QPlatPrivate::updateVersionInfo() {
         } else {
             spdlog::warn(PLAT_FMT_STR, currentSystem->get_system_id(),
                         "get_version", version_result.first);
+            QGCSJournal::record(QJournalEvent::InfoRequestFailed,
+                                currentSystem->get_system_id(), 0,
+                                static_cast<int64_t>(version_result.first));
         }
 
         // 获取产品信息
@@ -288,6 +433,9 @@ void QPlatPrivate::updateVersionInfo() {
         } else {
             spdlog::warn(PLAT_FMT_STR, currentSystem->get_system_id(),
                         "get_product", product_result.first);
+            QGCSJournal::record(QJournalEvent::InfoRequestFailed,
+                                currentSystem->get_system_id(), 1,
+                                static_cast<int64_t>(product_result.first));
         }
 
         if (state->active) {
@@ -298,7 +446,7 @@ void QPlatPrivate::updateVersionInfo() {
         state->updateRunning = false;
 
         if (bUpdate && state->active && plat) {
-            QMetaObject::invokeMethod(plat, "infoUpdated", Qt::QueuedConnection);
+            QQueuedInvoke::post(plat, &QPlat::infoUpdated);
         }
     });
 }
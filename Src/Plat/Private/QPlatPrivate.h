@@ -5,14 +5,19 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <vector>
 #include <mavsdk/system.h>
 #include <mavsdk/plugins/mavlink_direct/mavlink_direct.h>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
 #include <mavsdk/plugins/info/info.h>
+#include "Plat/Private/QMessageSubscription.h"
 
 // 前向声明
 class QPlat;
 
 class XmlToMavSDK;
+class QMavlinkMessageCounters;
+class QMavlinkMessageStats;
 
 /**
  * @brief QStandalone的私有实现类
@@ -79,6 +84,19 @@ public:
         return m_xmlExtension;
     }
 
+    /**
+     * @brief 设置整站共享的按系统消息计数（由地面站在接收路径上累计）
+     */
+    void setMessageStats(const std::shared_ptr<QMavlinkMessageStats> &stats)
+    {
+        m_messageStats = stats;
+    }
+
+    /**
+     * @brief 本平台的消息计数；尚未收到消息时返回 nullptr
+     */
+    QMavlinkMessageCounters *messageCounters() const;
+
     /**
      * @brief 设置消息处理回调
      * @param parent QVehicle实例指针，用于信号发射
@@ -90,12 +108,32 @@ public:
      */
     void syncConnectionStatus() const;
 
+    /**
+     * @brief 把 QPlat 的消息订阅挂到当前 System 的接收回调上
+     *
+     * 订阅会保留到 detachMessageSubscription()，setSystem() 切换 System 时自动重挂。
+     */
+    void attachMessageSubscription(const QMessageSubscription &subscription);
+    void detachMessageSubscription(int subscriptionId);
+
 private:
     /**
      * @brief 更新版本信息（通过 Info 插件）
      */
     void updateVersionInfo();
 
+    struct AttachedSubscription {
+        QMessageSubscription subscription;
+        /// MAVSDK 的 C 方言含该消息 ID 时走二进制帧，否则走 MavlinkDirect
+        bool binary{false};
+        mavsdk::MavlinkPassthrough::MessageHandle passthroughHandle;
+        mavsdk::MavlinkDirect::MessageHandle directHandle;
+    };
+
+    void subscribeMessage(AttachedSubscription &attached);
+    void unsubscribeMessage(AttachedSubscription &attached);
+    void unsubscribeMessages();
+
 protected:
     struct InfoState {
         mutable std::mutex mutex;
@@ -112,11 +150,15 @@ protected:
     std::shared_ptr<mavsdk::System> m_pSystem; ///< 系统对象
     std::shared_ptr<mavsdk::Info> m_pInfo;     ///< 信息插件
     std::shared_ptr<mavsdk::MavlinkDirect> m_pMavlinkDirect;
+    /// 内部订阅的高频消息（STATUSTEXT、COMMAND_ACK）在接收线程按二进制解码，不经 JSON
+    std::shared_ptr<mavsdk::MavlinkPassthrough> m_pMavlinkPassthrough;
     std::shared_ptr<XmlToMavSDK> m_xmlExtension; ///< 整站一份，按名发扩展命令
+    std::shared_ptr<QMavlinkMessageStats> m_messageStats; ///< 整站一份
 
     mavsdk::System::IsConnectedHandle m_hConntecd;
     mavsdk::System::ComponentDiscoveredHandle m_hCommonpentDiscovered;
-    mavsdk::MavlinkDirect::MessageHandle m_statusTextHandle;
+    mavsdk::MavlinkPassthrough::MessageHandle m_statusTextHandle;
+    std::vector<AttachedSubscription> m_messageSubscriptions;
 };
 
 #endif // QPLATPRIVATE_H
@@ -0,0 +1,97 @@
+#include "Plat/Private/QTelemetryBudget.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace QTelemetryBudget {
+
+namespace {
+bool reaches(const Link &link, uint8_t systemId)
+{
+    return link.systemIds.empty() ||
+        std::find(link.systemIds.begin(), link.systemIds.end(), systemId) !=
+            link.systemIds.end();
+}
+
+/**
+ * @brief 单条链路上的加权注水分配，结果写入 scales（取较小值）
+ */
+void allocateLink(const Link &link, const std::vector<Vehicle> &vehicles,
+                  std::vector<double> &scales)
+{
+    std::vector<std::size_t> members;
+    for (std::size_t index = 0; index < vehicles.size(); ++index) {
+        if (reaches(link, vehicles[index].systemId)) {
+            members.push_back(index);
+        }
+    }
+    if (members.empty()) {
+        return;
+    }
+
+    double remaining = link.budgetBytesPerSecond -
+        FixedBytesPerSecond * static_cast<double>(members.size());
+    double totalDemand = 0.0;
+    double remainingWeight = 0.0;
+    for (const std::size_t index : members) {
+        totalDemand += vehicles[index].demandBytesPerSecond;
+        remainingWeight += std::max(vehicles[index].weight, 0.0);
+    }
+    if (totalDemand <= remaining) {
+        return;
+    }
+    if (remaining <= 0.0 || remainingWeight <= 0.0) {
+        for (const std::size_t index : members) {
+            scales[index] = MinimumScale;
+        }
+        return;
+    }
+
+    /// 按「需求 / 权重」升序处理：份额足够的飞机拿走全部需求，
+    /// 第一架不够的飞机及其后所有飞机按权重平分剩余预算
+    std::sort(members.begin(), members.end(),
+              [&vehicles](std::size_t lhs, std::size_t rhs) {
+        const double left = vehicles[lhs].demandBytesPerSecond *
+            std::max(vehicles[rhs].weight, 0.0);
+        const double right = vehicles[rhs].demandBytesPerSecond *
+            std::max(vehicles[lhs].weight, 0.0);
+        return left < right;
+    });
+
+    for (auto it = members.begin(); it != members.end(); ++it) {
+        const Vehicle &vehicle = vehicles[*it];
+        const double weight = std::max(vehicle.weight, 0.0);
+        const double level = remaining / remainingWeight;
+        if (vehicle.demandBytesPerSecond <= level * weight) {
+            remaining -= vehicle.demandBytesPerSecond;
+            remainingWeight -= weight;
+            if (remainingWeight <= 0.0) {
+                break;
+            }
+            continue;
+        }
+        for (auto rest = it; rest != members.end(); ++rest) {
+            const Vehicle &limited = vehicles[*rest];
+            const double share = level * std::max(limited.weight, 0.0);
+            const double scale = std::clamp(
+                share / limited.demandBytesPerSecond, MinimumScale, 1.0);
+            scales[*rest] = std::min(scales[*rest], scale);
+        }
+        break;
+    }
+}
+} // namespace
+
+std::vector<double> allocate(const std::vector<Link> &links,
+                             const std::vector<Vehicle> &vehicles)
+{
+    std::vector<double> scales(vehicles.size(), 1.0);
+    for (const Link &link : links) {
+        if (link.budgetBytesPerSecond > 0.0) {
+            allocateLink(link, vehicles, scales);
+        }
+    }
+    return scales;
+}
+
+} // namespace QTelemetryBudget
@@ -0,0 +1,64 @@
+#ifndef QTELEMETRYBUDGET_H
+#define QTELEMETRYBUDGET_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 链路带宽感知的遥测频率分配
+ *
+ * 每条限速链路的可用预算按关注度权重在经该链路到达的飞机之间做加权
+ * 最大最小公平分配：需求不超过份额的飞机保持请求频率，剩余预算再分给
+ * 其他飞机。一架飞机经多条链路到达时取各链路中最小的倍数。
+ */
+namespace QTelemetryBudget {
+
+/**
+ * @brief 各遥测流对应消息的 MAVLink v2 帧长（12 字节帧开销 + 最大载荷）
+ *
+ * 下标与 QGCSConfigInternal::TelemetryRate 的位序一致。gps_info 与 raw_gps
+ * 请求的是同一条 GPS_RAW_INT，MAVSDK 只保留一个间隔，需求只计一次。
+ */
+inline constexpr std::array<double, 10> StreamFrameBytes = {
+    40.0,  ///< GLOBAL_POSITION_INT
+    40.0,  ///< LOCAL_POSITION_NED
+    64.0,  ///< GPS_RAW_INT
+    66.0,  ///< BATTERY_STATUS
+    64.0,  ///< GPS_RAW_INT（与 gps_info 同一条消息）
+    40.0,  ///< ATTITUDE
+    14.0,  ///< EXTENDED_SYS_STATE
+    55.0,  ///< SYS_STATUS
+    72.0,  ///< HOME_POSITION
+    32.0,  ///< VFR_HUD
+};
+
+/// 不随频率请求变化的每架飞机固定开销（1 Hz HEARTBEAT），分配前从链路预算中扣除
+inline constexpr double FixedBytesPerSecond = 21.0;
+
+/// 分配倍数下限，避免请求频率趋近于 0
+inline constexpr double MinimumScale = 0.01;
+
+struct Vehicle
+{
+    uint8_t systemId{0};
+    double demandBytesPerSecond{0.0}; ///< 按请求频率计算的遥测字节率，不含 FixedBytesPerSecond
+    double weight{1.0};               ///< 关注度权重，越大分得越多
+};
+
+struct Link
+{
+    double budgetBytesPerSecond{0.0}; ///< 可用于遥测的字节率，<= 0 表示不限
+    std::vector<uint8_t> systemIds;   ///< 经该链路到达的系统；为空表示全部
+};
+
+/**
+ * @brief 计算每架飞机的频率倍数
+ * @return 与 vehicles 下标一一对应的倍数，取值 [MinimumScale, 1]
+ */
+std::vector<double> allocate(const std::vector<Link> &links,
+                             const std::vector<Vehicle> &vehicles);
+
+} // namespace QTelemetryBudget
+
+#endif // QTELEMETRYBUDGET_H
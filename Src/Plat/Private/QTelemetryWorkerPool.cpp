@@ -0,0 +1,64 @@
+#include "Plat/Private/QTelemetryWorkerPool.h"
+#include "Private/QGCSConfigInternal.h"
+#include "Private/QGCSLog.h"
+#include <QCoreApplication>
+#include <QThread>
+
+QTelemetryWorkerPool *QTelemetryWorkerPool::instance()
+{
+    static QPointer<QTelemetryWorkerPool> pool;
+    static bool resolved = false;
+    if (resolved) {
+        return pool.data();
+    }
+
+    QCoreApplication *app = QCoreApplication::instance();
+    if (!app) {
+        return nullptr;
+    }
+    resolved = true;
+    const int threadCount = QGCSConfigInternal::telemetryWorkerThreads();
+    if (threadCount <= 0) {
+        return nullptr;
+    }
+    pool = new QTelemetryWorkerPool(threadCount, app);
+    spdlog::info(SYS_FMT_STR, "telemetry worker threads", threadCount);
+    return pool.data();
+}
+
+QTelemetryWorkerPool::QTelemetryWorkerPool(int threadCount, QObject *parent)
+    : QObject(parent)
+{
+    m_threads.reserve(threadCount);
+    m_contexts.reserve(threadCount);
+    for (int index = 0; index < threadCount; ++index) {
+        auto *thread = new QThread;
+        thread->setObjectName(
+            QStringLiteral("MiniGCSTelemetry%1").arg(index));
+        auto *context = new QObject;
+        context->moveToThread(thread);
+        thread->start();
+        m_threads.append(thread);
+        m_contexts.append(context);
+    }
+}
+
+QTelemetryWorkerPool::~QTelemetryWorkerPool()
+{
+    for (QThread *thread : std::as_const(m_threads)) {
+        thread->quit();
+    }
+    for (int index = 0; index < m_threads.size(); ++index) {
+        m_threads.at(index)->wait();
+        delete m_contexts.at(index);
+        delete m_threads.at(index);
+    }
+}
+
+QObject *QTelemetryWorkerPool::contextFor(quint32 systemId) const
+{
+    if (m_contexts.isEmpty()) {
+        return nullptr;
+    }
+    return m_contexts.at(static_cast<int>(systemId % m_contexts.size()));
+}
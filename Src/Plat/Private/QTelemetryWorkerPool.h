@@ -0,0 +1,42 @@
+#ifndef QTELEMETRYWORKERPOOL_H
+#define QTELEMETRYWORKERPOOL_H
+
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+
+class QThread;
+
+/**
+ * @brief 遥测归并工作线程池（可选）
+ *
+ * 按系统 ID 分片到固定数量的线程，同一载具的遥测始终在同一线程归并，
+ * 只有最终的变化集合回到 QAutopilot 所在线程。线程数由
+ * Telemetry/WorkerThreads 配置，为 0 时不创建线程池。
+ */
+class QTelemetryWorkerPool : public QObject
+{
+public:
+    /**
+     * @brief 获取线程池（首次调用需在主线程）
+     * @return 未启用工作线程时返回 nullptr
+     */
+    static QTelemetryWorkerPool *instance();
+
+    /**
+     * @brief 获取承载指定系统归并任务的线程上下文对象
+     */
+    QObject *contextFor(quint32 systemId) const;
+
+    int threadCount() const { return m_contexts.size(); }
+
+    ~QTelemetryWorkerPool() override;
+
+private:
+    QTelemetryWorkerPool(int threadCount, QObject *parent);
+
+    QVector<QThread *> m_threads;
+    QVector<QObject *> m_contexts;
+};
+
+#endif // QTELEMETRYWORKERPOOL_H
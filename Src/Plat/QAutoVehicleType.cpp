@@ -5,21 +5,21 @@
 QString QAutoVehicleType::getVehicleName(Vehicle type)
 {
     return QMavsdkTextCatalog::text(
-        QStringLiteral("vehicle"), static_cast<int>(type));
+        QMavsdkTextCatalog::Vehicle, static_cast<int>(type));
 }
 
 QString QAutoVehicleType::getVehicleName(int type)
 {
-    return QMavsdkTextCatalog::text(QStringLiteral("vehicle"), type);
+    return QMavsdkTextCatalog::text(QMavsdkTextCatalog::Vehicle, type);
 }
 
 QString QAutoVehicleType::getAutopilotName(Autopilot type)
 {
     return QMavsdkTextCatalog::text(
-        QStringLiteral("autopilot"), static_cast<int>(type));
+        QMavsdkTextCatalog::Autopilot, static_cast<int>(type));
 }
 
 QString QAutoVehicleType::getAutopilotName(int type)
 {
-    return QMavsdkTextCatalog::text(QStringLiteral("autopilot"), type);
+    return QMavsdkTextCatalog::text(QMavsdkTextCatalog::Autopilot, type);
 }
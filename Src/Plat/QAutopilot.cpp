@@ -1,18 +1,85 @@
 #include "Plat/QAutopilot.h"
 #include "Plat/Private/QAutopilotPrivate.h"
+#include "Plat/Private/QAutopilotTelemetryReducer.h"
+#include "Plat/Private/QAutopilotTelemetrySnapshot.h"
+#include "Plat/Private/QCommandMetrics.h"
+#include "Private/QGCSJournal.h"
+#include "Private/QGCSTrace.h"
+#include "Private/QLatencyHistogram.h"
+#include "Private/QGCSConfigInternal.h"
 #include "Private/QMavsdkTextCatalog.h"
-#include "QGCSConfig.h"
 #include <QDateTime>
 #include <QDebug>
+#include <QMetaMethod>
 #include <QMetaType>
 #include <QtGlobal>
+#include <array>
 #include <cmath>
 
+namespace {
+struct TelemetryLatencyStream
+{
+    const char *name;
+    quint32 fields; ///< 该流可能触发的 QAutopilotTelemetryChanges 字段
+};
+
+/// 下标与 QTelemetryStream 的位序一致
+constexpr std::array<TelemetryLatencyStream,
+                     QAutopilotTelemetryChanges::StreamCount>
+    TelemetryLatencyStreams = {{
+        {"position", QAutopilotTelemetryChanges::HasGpsPosition |
+                         QAutopilotTelemetryChanges::GpsPosition |
+                         QAutopilotTelemetryChanges::PositionDetails},
+        {"heading", QAutopilotTelemetryChanges::Attitude},
+        {"battery", QAutopilotTelemetryChanges::Status},
+        {"rawGps", QAutopilotTelemetryChanges::RawGps},
+        {"attitude", QAutopilotTelemetryChanges::Attitude},
+        {"positionVelocityNed", QAutopilotTelemetryChanges::NedPosition |
+                                    QAutopilotTelemetryChanges::Velocity |
+                                    QAutopilotTelemetryChanges::Moving},
+        {"health", QAutopilotTelemetryChanges::Status},
+        {"gpsInfo", QAutopilotTelemetryChanges::Status},
+        {"home", QAutopilotTelemetryChanges::HomePosition},
+        {"rcStatus", QAutopilotTelemetryChanges::Status},
+        {"fixedwingMetrics", QAutopilotTelemetryChanges::Fixedwing},
+        {"inAir", QAutopilotTelemetryChanges::Moving},
+    }};
+
+QLatencyStats latencyStats(const QString &name,
+                           const QLatencyHistogram &histogram)
+{
+    QLatencyStats stats;
+    stats.setName(name);
+    stats.setCount(histogram.count());
+    stats.setMinMs(histogram.minUs() / 1000.0);
+    stats.setMeanMs(histogram.meanUs() / 1000.0);
+    stats.setP50Ms(histogram.percentileUs(0.50) / 1000.0);
+    stats.setP90Ms(histogram.percentileUs(0.90) / 1000.0);
+    stats.setP99Ms(histogram.percentileUs(0.99) / 1000.0);
+    stats.setMaxMs(histogram.maxUs() / 1000.0);
+    return stats;
+}
+} // namespace
+
+struct QAutopilot::TelemetryLatency
+{
+    std::array<QLatencyHistogram, QAutopilotTelemetryChanges::StreamCount>
+        streams;
+};
+
 QAutopilot::QAutopilot(QObject *parent)
     : QPlat(parent)
+    , m_telemetryLatency(std::make_unique<TelemetryLatency>())
+    , m_commandMetrics(std::make_unique<QCommandMetrics>())
 {
+    qRegisterMetaType<QLatencyStats>("QLatencyStats");
+    qRegisterMetaType<QList<QLatencyStats>>("QList<QLatencyStats>");
+    qRegisterMetaType<QCommandStats>("QCommandStats");
+    qRegisterMetaType<QList<QCommandStats>>("QList<QCommandStats>");
     qRegisterMetaType<QAutopilot::FlightMode>("QAutopilot::FlightMode");
     qRegisterMetaType<QAutopilot::LandedState>("QAutopilot::LandedState");
+    qRegisterMetaType<QAutopilot::TelemetryProfile>(
+        "QAutopilot::TelemetryProfile");
     qRegisterMetaType<QList<QMissionPoint>>("QList<QMissionPoint>");
     connect(this, &QPlat::connectionStatusChanged, this,
             [this](bool connected) {
@@ -258,229 +325,273 @@ void QAutopilot::setAutopilotType(QAutoVehicleType::Autopilot autopilotType) {
     }
 }
 
-void QAutopilot::positionUpdate(double dLon, double dLat, float dH,
-                                float relativeAltitudeM) {
-    const bool firstPosition = !m_hasGpsPosition;
-    if (firstPosition ||
-        !qFuzzyCompare(m_gpsPosition.longitude(), dLon) ||
-        !qFuzzyCompare(m_gpsPosition.latitude(), dLat) ||
-        !qFuzzyCompare(m_gpsPosition.altitude(), dH)) {
+void QAutopilot::setTelemetryProfile(TelemetryProfile profile)
+{
+    if (m_telemetryProfile == profile) {
+        return;
+    }
+    m_telemetryProfile = profile;
+    /// 新档位的频率由地面站随预算重算一并排队下发
+    emit telemetryProfileChanged(m_telemetryProfile);
+}
+
+QAutopilotTelemetryState QAutopilot::telemetryState() const
+{
+    QAutopilotTelemetryState state;
+    state.gpsPosition = m_gpsPosition;
+    state.hasGpsPosition = m_hasGpsPosition;
+    state.relativeAltitudeM = m_relativeAltitudeM;
+    state.nedPosition = m_nedPosition;
+    state.homePosition = m_homePosition;
+    state.status = m_status;
+    state.fixedwing = m_fixedwing;
+    state.attitude = m_attitude;
+    state.velocity = m_velocity;
+    state.rawGps = m_rawGps;
+    state.moving = m_moving;
+    state.inAir = m_inAir;
+    return state;
+}
+
+void QAutopilot::applyTelemetryChanges(
+    const QAutopilotTelemetryChanges &changes)
+{
+    /// 区间包含接收者槽函数，用于定位阻塞界面线程的遥测处理
+    QGCS_TRACE_SCOPE_ID("telemetry", "applyTelemetryChanges", vehicleId());
+    /// 在发射信号前计时，不计入接收者槽函数的执行时间
+    const qint64 emitNs = QAutopilotTelemetrySnapshot::monotonicNs();
+    for (std::size_t index = 0; index < changes.sampleTimeNs.size(); ++index) {
+        const qint64 sampleNs = changes.sampleTimeNs[index];
+        if (sampleNs > 0 &&
+            (changes.fields & TelemetryLatencyStreams[index].fields)) {
+            m_telemetryLatency->streams[index].record(
+                (emitNs - sampleNs) / 1000);
+        }
+    }
+
+    const QAutopilotTelemetryState &state = changes.state;
+    if (changes.has(QAutopilotTelemetryChanges::GpsPosition)) {
+        const bool firstPosition = !m_hasGpsPosition;
         m_hasGpsPosition = true;
-        m_gpsPosition.setLongitude(dLon);
-        m_gpsPosition.setLatitude(dLat);
-        m_gpsPosition.setAltitude(dH);
+        m_gpsPosition = state.gpsPosition;
         if (firstPosition) {
             emit hasGpsPositionChanged(true);
         }
         emit gpsPositionChanged(m_gpsPosition);
     }
-    if (!qFuzzyCompare(m_relativeAltitudeM,
-                       static_cast<double>(relativeAltitudeM))) {
-        m_relativeAltitudeM = relativeAltitudeM;
+    if (changes.has(QAutopilotTelemetryChanges::PositionDetails)) {
+        m_relativeAltitudeM = state.relativeAltitudeM;
         emit positionDetailsChanged();
     }
+    if (changes.has(QAutopilotTelemetryChanges::HomePosition)) {
+        m_homePosition = state.homePosition;
+        emit homePositionChanged(m_homePosition);
+    }
+    if (changes.has(QAutopilotTelemetryChanges::Attitude)) {
+        m_attitude = state.attitude;
+        emit attitudeChanged(m_attitude);
+    }
+    if (changes.has(QAutopilotTelemetryChanges::NedPosition)) {
+        m_nedPosition = state.nedPosition;
+        emit nedPositionChanged(m_nedPosition);
+    }
+    if (changes.has(QAutopilotTelemetryChanges::Velocity)) {
+        m_velocity = state.velocity;
+        emit velocityChanged(m_velocity);
+    }
+    if (changes.has(QAutopilotTelemetryChanges::Moving)) {
+        m_moving = state.moving;
+        emit movingChanged(m_moving);
+    }
+    if (changes.has(QAutopilotTelemetryChanges::Status)) {
+        m_status = state.status;
+        emit statusChanged(m_status);
+    }
+    if (changes.has(QAutopilotTelemetryChanges::RawGps)) {
+        m_rawGps = state.rawGps;
+        emit rawGpsChanged(m_rawGps);
+    }
+    if (changes.has(QAutopilotTelemetryChanges::Fixedwing)) {
+        m_fixedwing = state.fixedwing;
+        emit fixedwingChanged(m_fixedwing);
+    }
 }
 
-QString QAutopilot::autopilotName() const
+QList<QLatencyStats> QAutopilot::telemetryLatencyStats() const
 {
-    return QAutoVehicleType::getAutopilotName(m_autopilotType);
+    QList<QLatencyStats> result;
+    for (std::size_t index = 0; index < TelemetryLatencyStreams.size();
+         ++index) {
+        const QLatencyHistogram &histogram =
+            m_telemetryLatency->streams[index];
+        if (histogram.count() > 0) {
+            result.append(latencyStats(
+                QLatin1String(TelemetryLatencyStreams[index].name),
+                histogram));
+        }
+    }
+    return result;
 }
 
-QString QAutopilot::vehicleName() const
+void QAutopilot::resetTelemetryLatencyStats()
 {
-    return QAutoVehicleType::getVehicleName(m_vehicleType);
+    for (QLatencyHistogram &histogram : m_telemetryLatency->streams) {
+        histogram.reset();
+    }
 }
 
-QString QAutopilot::flightModeName() const
+QList<QCommandStats> QAutopilot::commandStats() const
 {
-    const QString localized = QMavsdkTextCatalog::text(
-        QStringLiteral("flightMode"), static_cast<int>(m_flightMode));
-    const QString missing =
-        QStringLiteral("flightMode(%1)").arg(static_cast<int>(m_flightMode));
-    return localized == missing && !m_flightModeFallbackName.isEmpty()
-        ? m_flightModeFallbackName : localized;
+    QList<QCommandStats> result;
+    for (const QCommandMetrics::Command &command :
+         m_commandMetrics->commands()) {
+        QCommandStats stats;
+        stats.setName(command.name);
+        stats.setSent(command.sent);
+        stats.setAccepted(command.accepted);
+        stats.setRejected(command.rejected);
+        stats.setTimedOut(command.timedOut);
+        stats.setFailed(command.failed);
+        stats.setRetries(command.retries);
+        stats.setLatency(latencyStats(command.name, command.latency));
+        result.append(stats);
+    }
+    return result;
 }
 
-QString QAutopilot::landedStateName() const
+void QAutopilot::resetCommandStats()
 {
-    const QString localized = QMavsdkTextCatalog::text(
-        QStringLiteral("landedState"), static_cast<int>(m_landedState));
-    const QString missing =
-        QStringLiteral("landedState(%1)").arg(static_cast<int>(m_landedState));
-    return localized == missing && !m_landedStateFallbackName.isEmpty()
-        ? m_landedStateFallbackName : localized;
-}
-
-void QAutopilot::nedUpdate(float dNorth, float dEast, float dDown,
-                           float velocityNorth, float velocityEast,
-                           float velocityDown) {
-    if (!qFuzzyCompare(m_nedPosition.north(), dNorth) ||
-        !qFuzzyCompare(m_nedPosition.east(), dEast) ||
-        !qFuzzyCompare(m_nedPosition.down(), dDown)) {
-        m_nedPosition.setNorth(dNorth);
-        m_nedPosition.setEast(dEast);
-        m_nedPosition.setDown(dDown);
-        emit nedPositionChanged(m_nedPosition);
-    }
+    m_commandMetrics->reset();
+}
 
-    const double northSpeed = static_cast<double>(velocityNorth);
-    const double eastSpeed = static_cast<double>(velocityEast);
-    const double downSpeed = static_cast<double>(velocityDown);
-    if (!std::isfinite(northSpeed) ||
-        !std::isfinite(eastSpeed) ||
-        !std::isfinite(downSpeed)) {
-        return;
-    }
+namespace {
+struct DemandSignal
+{
+    QMetaMethod signal;
+    uint32_t rate;
+};
 
-    QVelocity next(northSpeed, eastSpeed, downSpeed);
-    if (m_velocity != next) {
-        m_velocity = next;
-        emit velocityChanged(m_velocity);
+const std::array<DemandSignal, 4> &demandSignals()
+{
+    static const std::array<DemandSignal, 4> table = {{
+        {QMetaMethod::fromSignal(&QAutopilot::attitudeChanged),
+         QGCSConfigInternal::TelemetryRateAttitude},
+        {QMetaMethod::fromSignal(&QAutopilot::rawGpsChanged),
+         QGCSConfigInternal::TelemetryRateRawGps},
+        {QMetaMethod::fromSignal(&QAutopilot::homePositionChanged),
+         QGCSConfigInternal::TelemetryRateHome},
+        {QMetaMethod::fromSignal(&QAutopilot::fixedwingChanged),
+         QGCSConfigInternal::TelemetryRateFixedwingMetrics},
+    }};
+    return table;
+}
+
+bool isDemandSignal(const QMetaMethod &signal)
+{
+    for (const DemandSignal &entry : demandSignals()) {
+        if (entry.signal == signal) {
+            return true;
+        }
     }
-    updateMovingState();
+    return false;
 }
+} // namespace
 
-void QAutopilot::armedUpdate(bool armed)
+void QAutopilot::connectNotify(const QMetaMethod &signal)
 {
-    if (m_armed == armed) {
-        return;
+    QPlat::connectNotify(signal);
+    if (isDemandSignal(signal)) {
+        scheduleTelemetryDemandUpdate();
     }
-    m_armed = armed;
-    emit armedChanged(m_armed);
 }
 
-void QAutopilot::inAirUpdate(bool inAir)
+void QAutopilot::disconnectNotify(const QMetaMethod &signal)
 {
-    if (m_inAir == inAir) {
-        return;
+    QPlat::disconnectNotify(signal);
+    /// 一次断开全部连接时传入的是无效方法，同样需要重新统计
+    if (!signal.isValid() || isDemandSignal(signal)) {
+        scheduleTelemetryDemandUpdate();
     }
-    m_inAir = inAir;
-    emit inAirChanged(m_inAir);
-    updateMovingState();
-}
-
-void QAutopilot::updateMovingState()
-{
-    const auto *config = QGCSConfig::instance();
-    const bool movementCandidate =
-        m_inAir ||
-        m_velocity.groundSpeedMS() >= config->motionStartHorizontalSpeedMS() ||
-        m_velocity.verticalSpeedMS() >= config->motionStartVerticalSpeedMS();
-    const bool stationaryCandidate =
-        !m_inAir &&
-        m_velocity.groundSpeedMS() <= config->motionStopHorizontalSpeedMS() &&
-        m_velocity.verticalSpeedMS() <= config->motionStopVerticalSpeedMS();
-
-    bool nextMoving = m_moving;
-    if (!m_moving) {
-        m_motionStopSamples = 0;
-        if (movementCandidate) {
-            ++m_motionStartSamples;
-            const int requiredSamples =
-                m_inAir ? 1 : config->motionStartSampleCount();
-            if (m_motionStartSamples >= requiredSamples) {
-                nextMoving = true;
-                m_motionStartSamples = 0;
-            }
-        } else {
-            m_motionStartSamples = 0;
-        }
-    } else {
-        m_motionStartSamples = 0;
-        if (stationaryCandidate) {
-            ++m_motionStopSamples;
-            if (m_motionStopSamples >= config->motionStopSampleCount()) {
-                nextMoving = false;
-                m_motionStopSamples = 0;
-            }
-        } else {
-            m_motionStopSamples = 0;
+}
+
+uint32_t QAutopilot::observedTelemetryRates() const
+{
+    uint32_t rates = 0;
+    for (const DemandSignal &entry : demandSignals()) {
+        if (!QGCSConfigInternal::telemetryDemandDriven() ||
+            isSignalConnected(entry.signal)) {
+            rates |= entry.rate;
         }
     }
+    return rates;
+}
 
-    if (m_moving != nextMoving) {
-        m_moving = nextMoving;
-        emit movingChanged(m_moving);
+void QAutopilot::scheduleTelemetryDemandUpdate()
+{
+    /// connectNotify 可能在任意线程调用；同一轮事件循环内的多次连接合并处理
+    if (m_telemetryDemandUpdatePending.exchange(true)) {
+        return;
     }
+    QMetaObject::invokeMethod(this, [this]() {
+        m_telemetryDemandUpdatePending = false;
+        if (d_func()) {
+            d_func()->setObservedTelemetryRates(observedTelemetryRates());
+        }
+    }, Qt::QueuedConnection);
 }
 
-void QAutopilot::gpsInfoUpdate(int gpsCount, int gpsStatus) {
-    bool changed = false;
-    
-    if (m_status.gpsCount() != gpsCount) {
-        m_status.setGpsCount(gpsCount);
-        changed = true;
-    }
-    
-    const QString chineseStatus =
-        QMavsdkTextCatalog::text(QStringLiteral("gpsFixType"), gpsStatus);
-    if (m_status.gpsStatus() != chineseStatus) {
-        m_status.setGpsStatus(chineseStatus);
-        changed = true;
-    }
-    
-    if (changed) {
-        emit statusChanged(m_status);
-    }
+QString QAutopilot::autopilotName() const
+{
+    return QAutoVehicleType::getAutopilotName(m_autopilotType);
 }
 
-void QAutopilot::batteryUpdate(int batteryId, float temperatureC,
-                               float batteryVoltage, float batteryCurrentA,
-                               float consumedAh, float batteryRemaining,
-                               float timeRemainingS, int batteryFunction) {
-    bool changed = false;
+QString QAutopilot::vehicleName() const
+{
+    return QAutoVehicleType::getVehicleName(m_vehicleType);
+}
 
-    if (!qFuzzyCompare(m_status.batteryVoltage(), batteryVoltage)) {
-        m_status.setBatteryVoltage(batteryVoltage);
-        changed = true;
-    }
-    if (!qFuzzyCompare(m_status.batteryRemaining(), batteryRemaining)) {
-        m_status.setBatteryRemaining(batteryRemaining);
-        changed = true;
-    }
-    if (m_status.batteryId() != batteryId) {
-        m_status.setBatteryId(batteryId);
-        changed = true;
-    }
-    if (!qFuzzyCompare(m_status.batteryTemperatureC(), temperatureC)) {
-        m_status.setBatteryTemperatureC(temperatureC);
-        changed = true;
-    }
-    if (!qFuzzyCompare(m_status.batteryCurrentA(), batteryCurrentA)) {
-        m_status.setBatteryCurrentA(batteryCurrentA);
-        changed = true;
-    }
-    if (!qFuzzyCompare(m_status.batteryConsumedAh(), consumedAh)) {
-        m_status.setBatteryConsumedAh(consumedAh);
-        changed = true;
-    }
-    if (!qFuzzyCompare(m_status.batteryTimeRemainingS(), timeRemainingS)) {
-        m_status.setBatteryTimeRemainingS(timeRemainingS);
-        changed = true;
+QString QAutopilot::flightModeName() const
+{
+    if (const QString *localized = QMavsdkTextCatalog::find(
+            QMavsdkTextCatalog::FlightMode, static_cast<int>(m_flightMode))) {
+        return *localized;
     }
-    const QString function = QMavsdkTextCatalog::text(
-        QStringLiteral("batteryFunction"), batteryFunction);
-    if (m_status.batteryFunction() != function) {
-        m_status.setBatteryFunction(function);
-        changed = true;
+    return !m_flightModeFallbackName.isEmpty()
+        ? m_flightModeFallbackName
+        : QMavsdkTextCatalog::text(QMavsdkTextCatalog::FlightMode,
+                                   static_cast<int>(m_flightMode));
+}
+
+QString QAutopilot::landedStateName() const
+{
+    if (const QString *localized = QMavsdkTextCatalog::find(
+            QMavsdkTextCatalog::LandedState, static_cast<int>(m_landedState))) {
+        return *localized;
     }
+    return !m_landedStateFallbackName.isEmpty()
+        ? m_landedStateFallbackName
+        : QMavsdkTextCatalog::text(QMavsdkTextCatalog::LandedState,
+                                   static_cast<int>(m_landedState));
+}
 
-    if (changed) {
-        emit statusChanged(m_status);
+void QAutopilot::armedUpdate(bool armed)
+{
+    if (m_armed == armed) {
+        return;
     }
+    m_armed = armed;
+    QGCSJournal::record(QJournalEvent::ArmedChanged,
+                        static_cast<uint8_t>(vehicleId()), armed ? 1 : 0);
+    emit armedChanged(m_armed);
 }
 
-void QAutopilot::attitudeUpdate(float rollDeg, float pitchDeg, float yawDeg)
+void QAutopilot::inAirUpdate(bool inAir)
 {
-    QAttitude next = m_attitude;
-    next.setRollDeg(rollDeg);
-    next.setPitchDeg(pitchDeg);
-    next.setYawDeg(yawDeg);
-    if (m_attitude == next) {
+    if (m_inAir == inAir) {
         return;
     }
-    m_attitude = next;
-    emit attitudeChanged(m_attitude);
+    m_inAir = inAir;
+    emit inAirChanged(m_inAir);
 }
 
 void QAutopilot::flightModeUpdate(QAutopilot::FlightMode flightMode,
@@ -492,6 +603,8 @@ void QAutopilot::flightModeUpdate(QAutopilot::FlightMode flightMode,
     }
     m_flightMode = flightMode;
     m_flightModeFallbackName = fallbackName;
+    QGCSJournal::record(QJournalEvent::FlightModeChanged,
+                        static_cast<uint8_t>(vehicleId()), flightMode);
     if (flightMode == FlightModeMission) {
         missionActiveUpdate(true);
     } else if (flightMode == FlightModeReturnToLaunch ||
@@ -514,151 +627,6 @@ void QAutopilot::landedStateUpdate(QAutopilot::LandedState landedState,
     emit landedStateChanged();
 }
 
-void QAutopilot::rawGpsUpdate(float hdop, float vdop, float velocityMS,
-                              float courseDeg, float horizontalUncertaintyM,
-                              float verticalUncertaintyM,
-                              float velocityUncertaintyMS,
-                              float headingUncertaintyDeg)
-{
-    QRawGps next = m_rawGps;
-    next.setHdop(hdop);
-    next.setVdop(vdop);
-    next.setVelocityMS(velocityMS);
-    next.setCourseDeg(courseDeg);
-    next.setHorizontalUncertaintyM(horizontalUncertaintyM);
-    next.setVerticalUncertaintyM(verticalUncertaintyM);
-    next.setVelocityUncertaintyMS(velocityUncertaintyMS);
-    next.setHeadingUncertaintyDeg(headingUncertaintyDeg);
-    if (m_rawGps == next) {
-        return;
-    }
-    m_rawGps = next;
-    emit rawGpsChanged(m_rawGps);
-}
-
-void QAutopilot::rcStatusUpdate(bool isAvailable, float signalStrengthPercent) {
-    bool changed = false;
-    
-    if (m_status.rcIsAvailable() != isAvailable) {
-        m_status.setRcIsAvailable(isAvailable);
-        changed = true;
-    }
-    if (!qFuzzyCompare(m_status.rcSignalStrengthPercent(), signalStrengthPercent)) {
-        m_status.setRcSignalStrengthPercent(signalStrengthPercent);
-        changed = true;
-    }
-    
-    if (changed) {
-        emit statusChanged(m_status);
-    }
-}
-
-void QAutopilot::headingUpdate(double heading) {
-    if (qFuzzyCompare(m_attitude.headingDeg(), heading)) {
-        return;
-    }
-    m_attitude.setHeadingDeg(heading);
-    emit attitudeChanged(m_attitude);
-}
-
-void QAutopilot::healthUpdate(bool isGyrometerCalibrationOk, bool isAccelerometerCalibrationOk,
-                              bool isMagnetometerCalibrationOk, bool isLocalPositionOk,
-                              bool isGlobalPositionOk, bool isHomePositionOk, bool isArmable)
-{
-    bool changed = false;
-
-    if (m_status.isGyrometerCalibrationOk() != isGyrometerCalibrationOk) {
-        m_status.setGyrometerCalibrationOk(isGyrometerCalibrationOk);
-        changed = true;
-    }
-    if (m_status.isAccelerometerCalibrationOk() != isAccelerometerCalibrationOk) {
-        m_status.setAccelerometerCalibrationOk(isAccelerometerCalibrationOk);
-        changed = true;
-    }
-    if (m_status.isMagnetometerCalibrationOk() != isMagnetometerCalibrationOk) {
-        m_status.setMagnetometerCalibrationOk(isMagnetometerCalibrationOk);
-        changed = true;
-    }
-    if (m_status.isLocalPositionOk() != isLocalPositionOk) {
-        m_status.setLocalPositionOk(isLocalPositionOk);
-        changed = true;
-    }
-    if (m_status.isGlobalPositionOk() != isGlobalPositionOk) {
-        m_status.setGlobalPositionOk(isGlobalPositionOk);
-        changed = true;
-    }
-    if (m_status.isHomePositionOk() != isHomePositionOk) {
-        m_status.setHomePositionOk(isHomePositionOk);
-        changed = true;
-    }
-    if (m_status.isArmable() != isArmable) {
-        m_status.setArmable(isArmable);
-        changed = true;
-    }
-
-    if (changed) {
-        emit statusChanged(m_status);
-    }
-}
-
-void QAutopilot::homeUpdate(double dLon, double dLat, float dH)
-{
-    if (!qFuzzyCompare(m_homePosition.longitude(), dLon) ||
-        !qFuzzyCompare(m_homePosition.latitude(), dLat) ||
-        !qFuzzyCompare(m_homePosition.altitude(), dH)) {
-        m_homePosition.setLongitude(dLon);
-        m_homePosition.setLatitude(dLat);
-        m_homePosition.setAltitude(dH);
-        emit homePositionChanged(m_homePosition);
-    }
-}
-
-void QAutopilot::fixedwingUpdate(float airspeedMS, float throttlePercentage, float climbRateMS,
-                                 float groundspeedMS, float headingDeg, float absoluteAltitudeM)
-{
-    bool changed = false;
-    
-    // 检查空速
-    if (!qFuzzyCompare(m_fixedwing.airspeedMS(), airspeedMS)) {
-        m_fixedwing.setAirspeedMS(airspeedMS);
-        changed = true;
-    }
-    
-    // 检查油门
-    if (!qFuzzyCompare(m_fixedwing.throttlePercentage(), throttlePercentage)) {
-        m_fixedwing.setThrottlePercentage(throttlePercentage);
-        changed = true;
-    }
-    
-    // 检查爬升率
-    if (!qFuzzyCompare(m_fixedwing.climbRateMS(), climbRateMS)) {
-        m_fixedwing.setClimbRateMS(climbRateMS);
-        changed = true;
-    }
-    
-    // 检查地速
-    if (!qFuzzyCompare(m_fixedwing.groundspeedMS(), groundspeedMS)) {
-        m_fixedwing.setGroundspeedMS(groundspeedMS);
-        changed = true;
-    }
-    
-    // 检查航向
-    if (!qFuzzyCompare(m_fixedwing.headingDeg(), headingDeg)) {
-        m_fixedwing.setHeadingDeg(headingDeg);
-        changed = true;
-    }
-    
-    // 检查绝对高度
-    if (!qFuzzyCompare(m_fixedwing.absoluteAltitudeM(), absoluteAltitudeM)) {
-        m_fixedwing.setAbsoluteAltitudeM(absoluteAltitudeM);
-        changed = true;
-    }
-    
-    if (changed) {
-        emit fixedwingChanged(m_fixedwing);
-    }
-}
-
 void QAutopilot::pauseAirLine()
 {
     if (m_airLineUploading || m_airLineDownloading) {
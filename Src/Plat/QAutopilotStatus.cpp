@@ -6,11 +6,11 @@
 QAutopilotStatus::QAutopilotStatus()
     : m_gpsCount(0),
       m_gpsStatus(QMavsdkTextCatalog::text(
-          QStringLiteral("gpsFixType"), -1)),
+          QMavsdkTextCatalog::GpsFixType, -1)),
       m_batteryVoltage(0.0f),
       m_batteryRemaining(0.0f),
       m_batteryFunction(QMavsdkTextCatalog::text(
-          QStringLiteral("batteryFunction"), -1))
+          QMavsdkTextCatalog::BatteryFunction, -1))
 {
 }
 
@@ -0,0 +1,54 @@
+#include "Plat/QCommandStats.h"
+
+void QCommandStats::setName(const QString &name)
+{
+    m_name = name;
+}
+
+void QCommandStats::setSent(quint64 sent)
+{
+    m_sent = sent;
+}
+
+void QCommandStats::setAccepted(quint64 accepted)
+{
+    m_accepted = accepted;
+}
+
+void QCommandStats::setRejected(quint64 rejected)
+{
+    m_rejected = rejected;
+}
+
+void QCommandStats::setTimedOut(quint64 timedOut)
+{
+    m_timedOut = timedOut;
+}
+
+void QCommandStats::setFailed(quint64 failed)
+{
+    m_failed = failed;
+}
+
+void QCommandStats::setRetries(quint64 retries)
+{
+    m_retries = retries;
+}
+
+void QCommandStats::setLatency(const QLatencyStats &latency)
+{
+    m_latency = latency;
+}
+
+bool QCommandStats::operator==(const QCommandStats &other) const
+{
+    return m_name == other.m_name && m_sent == other.m_sent &&
+           m_accepted == other.m_accepted && m_rejected == other.m_rejected &&
+           m_timedOut == other.m_timedOut && m_failed == other.m_failed &&
+           m_retries == other.m_retries && m_latency == other.m_latency;
+}
+
+bool QCommandStats::operator!=(const QCommandStats &other) const
+{
+    return !(*this == other);
+}
@@ -0,0 +1,38 @@
+#include "Plat/QMavlinkMessage.h"
+
+void QMavlinkMessage::setName(const QString &name)
+{
+    m_name = name;
+}
+
+void QMavlinkMessage::setMessageId(int messageId)
+{
+    m_messageId = messageId;
+}
+
+void QMavlinkMessage::setSystemId(int systemId)
+{
+    m_systemId = systemId;
+}
+
+void QMavlinkMessage::setComponentId(int componentId)
+{
+    m_componentId = componentId;
+}
+
+void QMavlinkMessage::setFields(const QVariantMap &fields)
+{
+    m_fields = fields;
+}
+
+bool QMavlinkMessage::operator==(const QMavlinkMessage &other) const
+{
+    return m_name == other.m_name && m_messageId == other.m_messageId &&
+           m_systemId == other.m_systemId &&
+           m_componentId == other.m_componentId && m_fields == other.m_fields;
+}
+
+bool QMavlinkMessage::operator!=(const QMavlinkMessage &other) const
+{
+    return !(*this == other);
+}
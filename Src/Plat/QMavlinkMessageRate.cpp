@@ -0,0 +1,38 @@
+#include "Plat/QMavlinkMessageRate.h"
+
+void QMavlinkMessageRate::setMessageId(int messageId)
+{
+    m_messageId = messageId;
+}
+
+void QMavlinkMessageRate::setPackets(quint64 packets)
+{
+    m_packets = packets;
+}
+
+void QMavlinkMessageRate::setBytes(quint64 bytes)
+{
+    m_bytes = bytes;
+}
+
+void QMavlinkMessageRate::setRateHz(double rateHz)
+{
+    m_rateHz = rateHz;
+}
+
+void QMavlinkMessageRate::setLastReceiveTime(const QDateTime &time)
+{
+    m_lastReceiveTime = time;
+}
+
+bool QMavlinkMessageRate::operator==(const QMavlinkMessageRate &other) const
+{
+    return m_messageId == other.m_messageId && m_packets == other.m_packets &&
+           m_bytes == other.m_bytes && m_rateHz == other.m_rateHz &&
+           m_lastReceiveTime == other.m_lastReceiveTime;
+}
+
+bool QMavlinkMessageRate::operator!=(const QMavlinkMessageRate &other) const
+{
+    return !(*this == other);
+}
@@ -1,10 +1,21 @@
 #include "Plat/QPlat.h"
 #include "Plat/Private/QPlatPrivate.h"
+#include "Plat/Private/QMavlinkMessageCounters.h"
+#include "Plat/Private/QMessageSubscription.h"
+#include "Extern/XmlToMavSDK.h"
+#include "Private/QGCSJournal.h"
+#include "Private/QGCSLog.h"
 #include <QDateTime>
+#include <QMetaType>
+#include <algorithm>
 
 QPlat::QPlat(QObject *parent)
-    : QObject(parent)
+    : QObject(parent),
+      m_messageSubscriptions(std::make_unique<QMessageSubscriptions>())
 {
+    qRegisterMetaType<QMavlinkMessageRate>("QMavlinkMessageRate");
+    qRegisterMetaType<QList<QMavlinkMessageRate>>("QList<QMavlinkMessageRate>");
+    qRegisterMetaType<QMavlinkMessage>("QMavlinkMessage");
 }
 
 
@@ -13,6 +24,10 @@ void QPlat::SetPrivate(QPlatPrivate *pPlatPrivate) {
     connect(this, &QPlat::connectionStatusChanged,
             this, &QPlat::updateConnection, Qt::UniqueConnection);
     d_ptr->setupMessageHandling();
+    for (const QMessageSubscription &subscription :
+         m_messageSubscriptions->items) {
+        d_ptr->attachMessageSubscription(subscription);
+    }
 }
 
 QPlat::~QPlat()
@@ -46,6 +61,8 @@ void QPlat::updateConnection(bool bConnected)
         return;
     }
     m_bConnected = bConnected;
+    QGCSJournal::record(QJournalEvent::ConnectionChanged,
+                        static_cast<uint8_t>(vehicleId()), bConnected ? 1 : 0);
 
     if (m_bConnected) {
         m_lastConnectedTime = QDateTime::currentDateTime();
@@ -72,3 +89,96 @@ QString QPlat::toString() const
     }
     return d_ptr->toString();
 }
+
+QList<QMavlinkMessageRate> QPlat::messageRates() const
+{
+    QList<QMavlinkMessageRate> result;
+    const QMavlinkMessageCounters *counters =
+        d_ptr ? d_ptr->messageCounters() : nullptr;
+    if (!counters) {
+        return result;
+    }
+    const auto messages =
+        counters->messages(QMavlinkMessageStats::nowMs());
+    result.reserve(static_cast<qsizetype>(messages.size()));
+    for (const QMavlinkMessageCounters::Message &message : messages) {
+        QMavlinkMessageRate rate;
+        rate.setMessageId(static_cast<int>(message.messageId));
+        rate.setPackets(message.packets);
+        rate.setBytes(message.bytes);
+        rate.setRateHz(message.rateHz);
+        rate.setLastReceiveTime(
+            QDateTime::fromMSecsSinceEpoch(message.lastReceiveMs));
+        result.append(rate);
+    }
+    return result;
+}
+
+quint64 QPlat::receivedPackets() const
+{
+    const QMavlinkMessageCounters *counters =
+        d_ptr ? d_ptr->messageCounters() : nullptr;
+    return counters ? counters->packetsReceived() : 0;
+}
+
+quint64 QPlat::lostPackets() const
+{
+    const QMavlinkMessageCounters *counters =
+        d_ptr ? d_ptr->messageCounters() : nullptr;
+    return counters ? counters->packetsLost() : 0;
+}
+
+double QPlat::packetLossPercent() const
+{
+    const quint64 received = receivedPackets();
+    const quint64 lost = lostPackets();
+    return received + lost > 0 ? 100.0 * lost / (received + lost) : 0.0;
+}
+
+void QPlat::resetMessageStats()
+{
+    if (QMavlinkMessageCounters *counters =
+            d_ptr ? d_ptr->messageCounters() : nullptr) {
+        counters->reset();
+    }
+}
+
+int QPlat::subscribeMessage(const QString &messageName, double maxRateHz)
+{
+    const std::shared_ptr<XmlToMavSDK> extension =
+        d_ptr ? d_ptr->mavMessageExtension() : nullptr;
+    auto schema = extension ? extension->findMessage(messageName) : nullptr;
+    if (!schema) {
+        spdlog::warn(PLAT_FMT_STR, vehicleId(), "subscribeMessage unknown",
+                     messageName.toStdString());
+        return 0;
+    }
+
+    QMessageSubscription subscription;
+    subscription.id = m_messageSubscriptions->nextId++;
+    subscription.schema = std::move(schema);
+    if (maxRateHz > 0.0) {
+        subscription.limiter =
+            std::make_shared<QMessageRateLimiter>(maxRateHz);
+    }
+    m_messageSubscriptions->items.push_back(subscription);
+    d_ptr->attachMessageSubscription(subscription);
+    return subscription.id;
+}
+
+void QPlat::unsubscribeMessage(int subscriptionId)
+{
+    auto &items = m_messageSubscriptions->items;
+    const auto it = std::find_if(
+        items.begin(), items.end(),
+        [subscriptionId](const QMessageSubscription &subscription) {
+            return subscription.id == subscriptionId;
+        });
+    if (it == items.end()) {
+        return;
+    }
+    items.erase(it);
+    if (d_ptr) {
+        d_ptr->detachMessageSubscription(subscriptionId);
+    }
+}
@@ -2,15 +2,40 @@
 #define QGCSCONFIGINTERNAL_H
 
 #include <QString>
+#include <QStringList>
 #include <cstdint>
 
+struct QGCSConfigSnapshot;
+
 /**
  * @brief 核心适配层专用配置入口（不进公开 Inc API）
  */
 namespace QGCSConfigInternal {
 
+/**
+ * @brief 遥测频率项位掩码，每位对应一个 Telemetry::set_rate_* 请求
+ */
+enum TelemetryRate : uint32_t {
+    TelemetryRatePosition = 1u << 0,
+    TelemetryRatePositionVelocityNed = 1u << 1,
+    TelemetryRateGpsInfo = 1u << 2,
+    TelemetryRateBattery = 1u << 3,
+    TelemetryRateRawGps = 1u << 4,
+    TelemetryRateAttitude = 1u << 5,
+    TelemetryRateLandedState = 1u << 6,
+    TelemetryRateHealth = 1u << 7,
+    TelemetryRateHome = 1u << 8,
+    TelemetryRateFixedwingMetrics = 1u << 9,
+    TelemetryRateAll = (1u << 10) - 1
+};
+
 void handleFirmwareLog(uint32_t vehicleId, int severity, const QString &text);
 QString messageExtensionFile();
+
+/**
+ * @brief 当前发布的配置快照；引用在进程内一直有效，可在任意线程读取
+ */
+const QGCSConfigSnapshot &snapshot();
 int commandAckTimeoutMs();
 
 double telemetryPositionHz();
@@ -23,6 +48,23 @@ double telemetryLandedStateHz();
 double telemetryHealthHz();
 double telemetryHomeHz();
 double telemetryFixedwingMetricsHz();
+int telemetryFlushIntervalMs();
+int telemetryWorkerThreads();
+/** 配置变化后逐架重发遥测频率的间隔（ms） */
+int telemetryRateUpdateIntervalMs();
+/** 姿态、原始 GPS、Home、固定翼指标是否只在有接收者时订阅 */
+bool telemetryDemandDriven();
+/** 单个 TelemetryRate 位对应的配置频率（Hz） */
+double telemetryRateHz(uint32_t rate);
+/** 限速链路带宽中可分配给遥测的比例，0 表示关闭预算 */
+double telemetryLinkBudgetUtilization();
+/** QAutopilot::TelemetryProfile 对应的频率缩放系数 */
+double telemetryProfileScale(int profile);
+
+/**
+ * @brief 将 settingsChanged 报告的键映射为需要重发的遥测频率位
+ */
+uint32_t telemetryRatesForKeys(const QStringList &keys);
 
 } // namespace QGCSConfigInternal
 
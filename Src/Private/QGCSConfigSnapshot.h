@@ -0,0 +1,55 @@
+#ifndef QGCSCONFIGSNAPSHOT_H
+#define QGCSCONFIGSNAPSHOT_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief 热路径配置项的只读快照
+ *
+ * 由 QGCSConfig 在 init()/save()/reload() 时从 INI 一次性读取并校验范围，
+ * 通过原子指针发布；发布后不再修改，读者拿到引用即可在任意线程直接读字段，
+ * 不再经过 QSettings::value() 的锁与 QVariant 转换。
+ */
+struct QGCSConfigSnapshot
+{
+    uint8_t stationId;
+    uint8_t stationComponentId;
+    bool timeSyncEnabled;
+
+    double motionStartHorizontalSpeedMS;
+    double motionStartVerticalSpeedMS;
+    double motionStopHorizontalSpeedMS;
+    double motionStopVerticalSpeedMS;
+    int motionStartSampleCount;
+    int motionStopSampleCount;
+
+    /// 已限制在 [1000, 60000]
+    int commandAckTimeoutMs;
+
+    double telemetryPositionHz;
+    double telemetryPositionVelocityNedHz;
+    double telemetryGpsInfoHz;
+    double telemetryBatteryHz;
+    double telemetryRawGpsHz;
+    double telemetryAttitudeHz;
+    double telemetryLandedStateHz;
+    double telemetryHealthHz;
+    double telemetryHomeHz;
+    double telemetryFixedwingMetricsHz;
+    /// 已限制在 [0, 1000]
+    int telemetryFlushIntervalMs;
+    /// 已限制在 [0, 16]
+    int telemetryWorkerThreads;
+    /// 已限制在 [0, 1000]
+    int telemetryRateUpdateIntervalMs;
+    bool telemetryDemandDriven;
+    /// 已限制在 [0, 1]，0 表示不按链路带宽分配
+    double telemetryLinkBudgetUtilization;
+    /// 按 QAutopilot::TelemetryProfile 下标，已限制在 [0.01, 10]
+    std::array<double, 3> telemetryProfileScale;
+
+    bool operator==(const QGCSConfigSnapshot &) const = default;
+};
+
+#endif // QGCSCONFIGSNAPSHOT_H
@@ -0,0 +1,164 @@
+#include "Private/QGCSJournal.h"
+#include "Private/QGCSLog.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+namespace QGCSJournal {
+
+std::atomic_bool g_enabled{false};
+
+namespace {
+struct JournalState
+{
+    std::mutex mutex;
+    QFile file;
+    uchar *data{nullptr};
+    uint32_t capacity{0};
+};
+
+JournalState &journalState()
+{
+    static JournalState state;
+    return state;
+}
+
+int64_t nowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+qint64 fileSize(uint32_t capacity)
+{
+    return static_cast<qint64>(sizeof(FileHeader)) +
+           static_cast<qint64>(capacity) * static_cast<qint64>(sizeof(Record));
+}
+
+bool headerMatches(const FileHeader &header, uint32_t capacity)
+{
+    return std::memcmp(header.magic, Magic, sizeof(Magic)) == 0 &&
+           header.version == FormatVersion &&
+           header.recordSize == sizeof(Record) &&
+           header.capacity == capacity && header.nextSequence >= 1;
+}
+
+/// 调用方持有 state.mutex
+void closeFile(JournalState &state)
+{
+    g_enabled.store(false, std::memory_order_relaxed);
+    if (state.data) {
+        state.file.unmap(state.data);
+        state.data = nullptr;
+    }
+    state.file.close();
+    state.capacity = 0;
+}
+} // namespace
+
+bool start(const QString &path, uint32_t capacity)
+{
+    JournalState &state = journalState();
+    std::scoped_lock lock(state.mutex);
+    if (state.data && state.file.fileName() == path &&
+        state.capacity == capacity) {
+        return true;
+    }
+    closeFile(state);
+    if (path.isEmpty() || capacity == 0) {
+        return false;
+    }
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    state.file.setFileName(path);
+    if (!state.file.open(QIODevice::ReadWrite)) {
+        spdlog::error(SYS_FMT_STR, "journal open failed",
+                      state.file.errorString().toStdString());
+        return false;
+    }
+
+    const qint64 size = fileSize(capacity);
+    FileHeader existing{};
+    const bool reuse =
+        state.file.size() == size &&
+        state.file.read(reinterpret_cast<char *>(&existing),
+                        sizeof(existing)) == sizeof(existing) &&
+        headerMatches(existing, capacity);
+    /// 格式或容量不同的旧文件整体清零重建
+    if (!reuse && (!state.file.resize(0) || !state.file.resize(size))) {
+        spdlog::error(SYS_FMT_STR, "journal resize failed",
+                      state.file.errorString().toStdString());
+        closeFile(state);
+        return false;
+    }
+    state.data = state.file.map(0, size);
+    if (!state.data) {
+        spdlog::error(SYS_FMT_STR, "journal map failed",
+                      state.file.errorString().toStdString());
+        closeFile(state);
+        return false;
+    }
+    if (!reuse) {
+        FileHeader header{};
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version = FormatVersion;
+        header.recordSize = sizeof(Record);
+        header.capacity = capacity;
+        header.nextSequence = 1;
+        std::memcpy(state.data, &header, sizeof(header));
+    }
+    state.capacity = capacity;
+    g_enabled.store(true, std::memory_order_relaxed);
+    spdlog::info(SYS_FMT_STR, "journal enabled",
+                 fmt::format("{} ({} records)", path.toStdString(), capacity));
+    return true;
+}
+
+void stop()
+{
+    JournalState &state = journalState();
+    std::scoped_lock lock(state.mutex);
+    closeFile(state);
+}
+
+QString activeFile()
+{
+    JournalState &state = journalState();
+    std::scoped_lock lock(state.mutex);
+    return state.data ? state.file.fileName() : QString();
+}
+
+void append(QJournalEvent::Type type, uint8_t systemId, uint8_t componentId,
+            int32_t code, int64_t value)
+{
+    const int64_t timestampMs = nowMs();
+    JournalState &state = journalState();
+    std::scoped_lock lock(state.mutex);
+    if (!state.data) {
+        return;
+    }
+    auto *header = reinterpret_cast<FileHeader *>(state.data);
+    auto *records = reinterpret_cast<Record *>(state.data + sizeof(FileHeader));
+    std::atomic_ref<uint64_t> nextSequence(header->nextSequence);
+    const uint64_t sequence = nextSequence.load(std::memory_order_relaxed);
+    Record &record = records[(sequence - 1) % state.capacity];
+
+    std::atomic_ref<uint64_t> recordSequence(record.sequence);
+    recordSequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.timestampMs = timestampMs;
+    record.type = static_cast<uint16_t>(type);
+    record.systemId = systemId;
+    record.componentId = componentId;
+    record.code = code;
+    record.value = value;
+    recordSequence.store(sequence, std::memory_order_release);
+    nextSequence.store(sequence + 1, std::memory_order_release);
+}
+
+} // namespace QGCSJournal
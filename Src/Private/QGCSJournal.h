@@ -0,0 +1,92 @@
+#ifndef QGCSJOURNAL_H
+#define QGCSJOURNAL_H
+
+#include <QString>
+#include <atomic>
+#include <cstdint>
+#include "Common/QJournalEvent.h"
+
+/**
+ * @brief 二进制事件日志：定长记录写入内存映射的环形文件
+ *
+ * 由 Journal/File 配置开启。每条记录 32 字节，只含时间、系统 ID、事件类型与
+ * 数值载荷；记录一次是加锁后的一次内存拷贝，不格式化、不做文件 I/O，
+ * 写满后覆盖最旧的记录。未开启时每个记录点只做一次 relaxed 原子读。
+ * 读取接口为 QEventJournal。
+ */
+namespace QGCSJournal {
+
+/** 文件头魔数，末位为格式版本 */
+inline constexpr char Magic[8] = {'M', 'G', 'C', 'S', 'J', 'R', 'N', '1'};
+inline constexpr uint32_t FormatVersion = 1;
+
+/**
+ * @brief 文件头（本机字节序），其后紧跟 capacity 条 Record
+ */
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t capacity;
+    uint32_t reserved0;
+    /** 下一条记录的序号；序号 n 的记录位于 (n - 1) % capacity */
+    uint64_t nextSequence;
+    uint8_t reserved[32];
+};
+static_assert(sizeof(FileHeader) == 64);
+
+/**
+ * @brief 定长记录
+ *
+ * sequence 最后写入：写入过程中为 0，读取方在拷贝前后各读一次，
+ * 两次一致且等于期望序号才采用（seqlock），跨进程读取正在写的文件也不会读到半条记录。
+ */
+struct Record
+{
+    int64_t timestampMs;
+    uint64_t sequence;
+    uint16_t type;
+    uint8_t systemId;
+    uint8_t componentId;
+    int32_t code;
+    int64_t value;
+};
+static_assert(sizeof(Record) == 32);
+
+extern std::atomic_bool g_enabled;
+
+inline bool enabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 打开（必要时创建）日志文件并开始记录
+ *
+ * 已有文件的格式与容量一致时接着写，否则重新初始化。
+ */
+bool start(const QString &path, uint32_t capacity);
+
+/** 停止记录并解除映射 */
+void stop();
+
+/** 当前写入的文件；未开启时为空 */
+QString activeFile();
+
+void append(QJournalEvent::Type type, uint8_t systemId, uint8_t componentId,
+            int32_t code, int64_t value);
+
+/** 记录一条事件；未开启时直接返回 */
+inline void record(QJournalEvent::Type type, uint8_t systemId,
+                   int32_t code = 0, int64_t value = 0,
+                   uint8_t componentId = 0)
+{
+    if (enabled()) {
+        append(type, systemId, componentId, code, value);
+    }
+}
+
+} // namespace QGCSJournal
+
+#endif // QGCSJOURNAL_H
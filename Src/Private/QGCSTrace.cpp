@@ -0,0 +1,167 @@
+#include "Private/QGCSTrace.h"
+#include "Private/QGCSLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+namespace QGCSTrace {
+
+std::atomic_bool g_enabled{false};
+
+namespace {
+struct Event
+{
+    const char *category;
+    const char *name;
+    int64_t startUs;
+    int64_t durationUs;
+    int64_t id;
+    uint32_t threadId;
+};
+
+struct TraceState
+{
+    std::mutex mutex;
+    std::filesystem::path path;
+    std::vector<Event> events;
+    std::size_t maxEvents{0};
+    uint64_t droppedEvents{0};
+};
+
+TraceState &traceState()
+{
+    static TraceState state;
+    return state;
+}
+
+/// Chrome trace 只要求线程号为整数；按首次记录顺序编号，比系统线程号更易读
+uint32_t currentThreadId()
+{
+    static std::atomic<uint32_t> nextThreadId{1};
+    thread_local const uint32_t threadId =
+        nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+void writeEvents(const std::filesystem::path &path,
+                 const std::vector<Event> &events, uint64_t droppedEvents)
+{
+    if (path.empty()) {
+        return;
+    }
+    std::error_code error;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), error);
+    }
+
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer),
+                   "{{\"displayTimeUnit\":\"ms\",\"otherData\":"
+                   "{{\"droppedEvents\":{}}},\"traceEvents\":[\n"
+                   "{{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":1,"
+                   "\"tid\":0,\"args\":{{\"name\":\"MiniGCS\"}}}}",
+                   droppedEvents);
+    for (const Event &event : events) {
+        fmt::format_to(std::back_inserter(buffer),
+                       ",\n{{\"ph\":\"X\",\"cat\":\"{}\",\"name\":\"{}\","
+                       "\"ts\":{},\"dur\":{},\"pid\":1,\"tid\":{}",
+                       event.category, event.name, event.startUs,
+                       event.durationUs, event.threadId);
+        if (event.id >= 0) {
+            fmt::format_to(std::back_inserter(buffer),
+                           ",\"args\":{{\"id\":{}}}", event.id);
+        }
+        buffer.push_back('}');
+    }
+    fmt::format_to(std::back_inserter(buffer), "\n]}}\n");
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!file) {
+        spdlog::error(SYS_FMT_STR, "trace write failed", path.string());
+        return;
+    }
+    spdlog::info(SYS_FMT_STR, "trace written",
+                 fmt::format("{} ({} events, {} dropped)", path.string(),
+                             events.size(), droppedEvents));
+}
+
+/// 在锁内取出已缓冲的事件，锁外写文件
+void takeEvents(TraceState &state, std::filesystem::path &path,
+                std::vector<Event> &events, uint64_t &droppedEvents)
+{
+    path = std::move(state.path);
+    state.path.clear();
+    events.swap(state.events);
+    droppedEvents = state.droppedEvents;
+    state.droppedEvents = 0;
+}
+} // namespace
+
+int64_t nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool start(const std::filesystem::path &path, std::size_t maxEvents)
+{
+    TraceState &state = traceState();
+    std::filesystem::path previousPath;
+    std::vector<Event> previousEvents;
+    uint64_t previousDropped = 0;
+    {
+        std::scoped_lock lock(state.mutex);
+        takeEvents(state, previousPath, previousEvents, previousDropped);
+        if (path.empty() || maxEvents == 0) {
+            g_enabled.store(false, std::memory_order_relaxed);
+        } else {
+            state.path = path;
+            state.maxEvents = maxEvents;
+            /// 预留一小部分，避免记录早期反复扩容；上限很大时按需增长
+            state.events.reserve(std::min<std::size_t>(maxEvents, 4096));
+            g_enabled.store(true, std::memory_order_relaxed);
+        }
+    }
+    writeEvents(previousPath, previousEvents, previousDropped);
+    return !path.empty() && maxEvents > 0;
+}
+
+void stop()
+{
+    TraceState &state = traceState();
+    std::filesystem::path path;
+    std::vector<Event> events;
+    uint64_t droppedEvents = 0;
+    {
+        std::scoped_lock lock(state.mutex);
+        g_enabled.store(false, std::memory_order_relaxed);
+        takeEvents(state, path, events, droppedEvents);
+    }
+    writeEvents(path, events, droppedEvents);
+}
+
+void complete(const char *category, const char *name, int64_t startUs,
+              int64_t durationUs, int64_t id)
+{
+    const uint32_t threadId = currentThreadId();
+    TraceState &state = traceState();
+    std::scoped_lock lock(state.mutex);
+    if (!g_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (state.events.size() >= state.maxEvents) {
+        ++state.droppedEvents;
+        return;
+    }
+    state.events.push_back(
+        Event{category, name, startUs, durationUs, id, threadId});
+}
+
+} // namespace QGCSTrace
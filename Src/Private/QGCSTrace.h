@@ -0,0 +1,106 @@
+#ifndef QGCSTRACE_H
+#define QGCSTRACE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+/**
+ * @brief 库内部耗时跟踪，输出 Chrome trace JSON（chrome://tracing 与 Perfetto 可打开）
+ *
+ * 由 Trace/File 配置开启，关闭或重新加载配置时写出文件。未开启时每个跟踪点
+ * 只做一次 relaxed 原子读；以 MINIGCS_ENABLE_TRACE=OFF 构建时跟踪点整体移除。
+ * 事件名与类别须为字符串字面量，记录时不复制、不转义。
+ */
+namespace QGCSTrace {
+
+extern std::atomic_bool g_enabled;
+
+inline bool enabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+/** 单调时钟（微秒） */
+int64_t nowUs();
+
+/**
+ * @brief 开始记录；已在记录时先写出之前的事件
+ * @param maxEvents 缓冲事件上限，超出的事件丢弃并计数
+ */
+bool start(const std::filesystem::path &path, std::size_t maxEvents);
+
+/** 停止记录并写出文件 */
+void stop();
+
+/**
+ * @brief 记录一个完整区间（ph="X"）；id 小于 0 时不带参数
+ */
+void complete(const char *category, const char *name, int64_t startUs,
+              int64_t durationUs, int64_t id = -1);
+
+/**
+ * @brief 作用域区间，析构时记录
+ */
+class Scope
+{
+public:
+    Scope(const char *category, const char *name, int64_t id = -1)
+        : m_category(category)
+        , m_name(name)
+        , m_id(id)
+        , m_startUs(enabled() ? nowUs() : -1)
+    {}
+
+    ~Scope()
+    {
+        if (m_startUs >= 0) {
+            complete(m_category, m_name, m_startUs, nowUs() - m_startUs, m_id);
+        }
+    }
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    const char *m_category;
+    const char *m_name;
+    int64_t m_id;
+    int64_t m_startUs;
+};
+
+} // namespace QGCSTrace
+
+#define QGCS_TRACE_CONCAT_INNER(a, b) a##b
+#define QGCS_TRACE_CONCAT(a, b) QGCS_TRACE_CONCAT_INNER(a, b)
+
+#ifdef MINIGCS_NO_TRACE
+#define QGCS_TRACE_SCOPE(category, name) static_cast<void>(0)
+#define QGCS_TRACE_SCOPE_ID(category, name, id) static_cast<void>(id)
+#define QGCS_TRACE_NOW() int64_t{-1}
+#define QGCS_TRACE_COMPLETE(category, name, startUs, id) \
+    static_cast<void>((static_cast<void>(startUs), (id)))
+#else
+/** 当前作用域的同步区间 */
+#define QGCS_TRACE_SCOPE(category, name) \
+    QGCSTrace::Scope QGCS_TRACE_CONCAT(qgcsTraceScope, __LINE__)(category, name)
+#define QGCS_TRACE_SCOPE_ID(category, name, id)                          \
+    QGCSTrace::Scope QGCS_TRACE_CONCAT(qgcsTraceScope, __LINE__)(        \
+        category, name, static_cast<int64_t>(id))
+/** 异步区间的起点；未开启时为 -1 */
+#define QGCS_TRACE_NOW() \
+    (QGCSTrace::enabled() ? QGCSTrace::nowUs() : int64_t{-1})
+/** 以 QGCS_TRACE_NOW() 取得的起点结束异步区间 */
+#define QGCS_TRACE_COMPLETE(category, name, startUs, id)                   \
+    do {                                                                   \
+        const int64_t qgcsTraceStartUs = (startUs);                        \
+        if (qgcsTraceStartUs >= 0 && QGCSTrace::enabled()) {               \
+            QGCSTrace::complete(category, name, qgcsTraceStartUs,          \
+                                QGCSTrace::nowUs() - qgcsTraceStartUs,     \
+                                static_cast<int64_t>(id));                 \
+        }                                                                  \
+    } while (false)
+#endif
+
+#endif // QGCSTRACE_H
@@ -1,23 +1,38 @@
 #include <QMetaObject>
 #include <QMetaMethod>
 #include <QByteArray>
+#include <QElapsedTimer>
 #include <QPointer>
 #include <QThreadPool>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
 
 #include "Private/QGroundControlStationPrivate.h"
 #include "Plat/Private/QAutopilotPrivate.h"
+#include "Plat/Private/QMavlinkMessageCounters.h"
+#include "Plat/Private/QTelemetryBudget.h"
 #include "Plat/QPlat.h"
+#include "Plat/QAutopilot.h"
 #include "QGroundControlStation.h"
 #include "Link/QDataLink.h"
 #include "Link/QLinkManager.h"
+#include "Link/Private/QLinkManagerPrivate.h"
+#include "Link/Private/QLinkTrafficCounters.h"
+#include "Link/Private/QRawPacketRing.h"
 #include "Extern/XmlToMavSDK.h"
 
 #include "QGCSConfig.h"
 #include "Private/QGCSConfigInternal.h"
 #include "Private/QGCSLog.h"
+#include "Private/QGCSTrace.h"
+#include "Private/QQueuedInvoke.h"
 
 QGroundControlStationPrivate::QGroundControlStationPrivate()
     : m_isInitialized(false)
+    , m_trafficRoutes(std::make_shared<LinkTrafficRoutes>())
+    , m_messageStats(std::make_shared<QMavlinkMessageStats>())
 {
 }
 
@@ -51,6 +66,7 @@ void QGroundControlStationPrivate::initializeMavsdk()
     config.set_system_id(QGCSConfig::instance()->stationId());
     config.set_component_id(QGCSConfig::instance()->stationComponentId());
     m_mavsdk = std::make_shared<mavsdk::Mavsdk>(config);
+    setupLinkTrafficInterception();
 
     /// 解析扩展 XML 中的 MAV_CMD 表。
     /// MAVSDK 已内嵌 ARDUPILOTMEGA；仅当配置指向额外自定义 XML 时才注入共享 MessageSet。
@@ -78,6 +94,111 @@ void QGroundControlStationPrivate::initializeMavsdk()
     m_isInitialized = true;
 }
 
+namespace {
+/// 消息的 target_system 字段；没有该字段时返回 0（广播）
+uint8_t messageTargetSystem(const mavlink_message_t &message)
+{
+    const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(message.msgid);
+    if (!entry || !(entry->flags & MAV_MSG_ENTRY_FLAG_HAVE_TARGET_SYSTEM) ||
+        entry->target_system_ofs >= message.len) {
+        return 0;
+    }
+    return static_cast<uint8_t>(
+        _MAV_PAYLOAD(&message)[entry->target_system_ofs]);
+}
+} // namespace
+
+void QGroundControlStationPrivate::setupLinkTrafficInterception()
+{
+    const std::shared_ptr<LinkTrafficRoutes> routes = m_trafficRoutes;
+    const std::shared_ptr<QMavlinkMessageStats> messageStats = m_messageStats;
+    m_mavsdk->intercept_incoming_messages_async(
+        [routes, messageStats](mavlink_message_t &message) {
+            const std::size_t frameBytes =
+                mavlink_msg_get_send_buffer_length(&message);
+            messageStats->record(message.sysid, message.compid, message.msgid,
+                                 message.seq, frameBytes);
+            const auto snapshot =
+                routes->current.load(std::memory_order_acquire);
+            if (!snapshot) {
+                return true;
+            }
+            for (const LinkTrafficRoute &route : *snapshot) {
+                if (route.reaches(message.sysid)) {
+                    route.counters->recordReceivedPacket(
+                        message.sysid, message.compid, message.seq,
+                        frameBytes);
+                }
+            }
+            return true;
+        });
+    m_mavsdk->intercept_outgoing_messages_async(
+        [routes, messageStats](mavlink_message_t &message) {
+            const std::size_t frameBytes =
+                mavlink_msg_get_send_buffer_length(&message);
+            /// 命令重发计数：MAVSDK 在超时后原样重发同一 MAV_CMD
+            if (message.msgid == MAVLINK_MSG_ID_COMMAND_LONG) {
+                messageStats->recordCommandSent(
+                    mavlink_msg_command_long_get_target_system(&message),
+                    mavlink_msg_command_long_get_command(&message));
+            } else if (message.msgid == MAVLINK_MSG_ID_COMMAND_INT) {
+                messageStats->recordCommandSent(
+                    mavlink_msg_command_int_get_target_system(&message),
+                    mavlink_msg_command_int_get_command(&message));
+            }
+            const auto snapshot =
+                routes->current.load(std::memory_order_acquire);
+            if (!snapshot) {
+                return true;
+            }
+            /// 广播消息（无目标或目标为 0）经每条链路发出，定向消息只计入到达目标的链路
+            const uint8_t targetSystem = messageTargetSystem(message);
+            for (const LinkTrafficRoute &route : *snapshot) {
+                if (targetSystem == 0 || route.reaches(targetSystem)) {
+                    route.counters->recordSentPacket(frameBytes);
+                }
+            }
+            return true;
+        });
+}
+
+void QGroundControlStationPrivate::refreshLinkTrafficRoutes(
+    QGroundControlStation *station)
+{
+    std::vector<LinkTrafficRoute> routes;
+    if (station && station->m_linkManager &&
+        station->m_linkManager->d_func()) {
+        QVector<QDataLink *> openLinks;
+        for (QDataLink *link : station->m_linkManager->d_func()->links()) {
+            if (link->isOpened()) {
+                openLinks.append(link);
+            }
+        }
+        for (QDataLink *link : std::as_const(openLinks)) {
+            /// Raw 链路在喂入与取出字节处自行计数，避免重复
+            if (link->linkKind() == LinkKind::Raw) {
+                continue;
+            }
+            /// 拦截回调不带连接句柄：未指定归属的链路只有在它是唯一连接时
+            /// 才能确定流量来源，否则保持为 0，避免各链路显示相同的总量
+            const QList<int> assigned = link->assignedSystemIds();
+            if (assigned.isEmpty() && openLinks.size() > 1) {
+                continue;
+            }
+            LinkTrafficRoute route;
+            route.counters = link->trafficCounters();
+            for (const int systemId : assigned) {
+                route.systemIds.push_back(static_cast<uint8_t>(systemId));
+            }
+            routes.push_back(std::move(route));
+        }
+    }
+    m_trafficRoutes->current.store(
+        std::make_shared<const std::vector<LinkTrafficRoute>>(
+            std::move(routes)),
+        std::memory_order_release);
+}
+
 template<>struct fmt::formatter<mavsdk::MavlinkDirect::Result>:ostream_formatter{};
 
 void QGroundControlStationPrivate::ensureCustomXmlLoaded(
@@ -103,6 +224,8 @@ void QGroundControlStationPrivate::ensureCustomXmlLoaded(
             return;
         }
 
+        QGCS_TRACE_SCOPE_ID("xml", "applyCustomXml",
+                            currentSystem->get_system_id());
         /// 任意 System 上的 MavlinkDirect 均可，最终写入 MavsdkImpl 全局 MessageSet
         mavsdk::MavlinkDirect mavlinkDirect(*currentSystem);
         const auto result = extension->applyCustomXmlOnce(mavlinkDirect);
@@ -121,54 +244,90 @@ void QGroundControlStationPrivate::ensureCustomXmlLoaded(
 
 QVector<std::shared_ptr<mavsdk::System>> QGroundControlStationPrivate::getConnectedSystems() const
 {
-    if (!m_mavsdk) {
-        return QVector<std::shared_ptr<mavsdk::System>>();
-    }
-    
-    auto systems = m_mavsdk->systems();
     QVector<std::shared_ptr<mavsdk::System>> result;
-    
-    for (auto system : systems) {
-        if (system->is_connected()) {
+    result.reserve(m_indexedSystemIds.size());
+    for (const uint8_t systemId : m_indexedSystemIds) {
+        const auto &system = m_systemIndex[systemId];
+        if (system && system->is_connected()) {
             result.append(system);
         }
     }
-    
     return result;
 }
 
 QVector<uint8_t> QGroundControlStationPrivate::getConnectedSystemIds() const
 {
-    if (!m_mavsdk) {
-        return QVector<uint8_t>();
-    }
-    
-    auto systems = m_mavsdk->systems();
     QVector<uint8_t> result;
-    
-    for (auto system : systems) {
-        if (system->is_connected()) {
-            result.append(system->get_system_id());
+    result.reserve(m_indexedSystemIds.size());
+    for (const uint8_t systemId : m_indexedSystemIds) {
+        const auto &system = m_systemIndex[systemId];
+        if (system && system->is_connected()) {
+            result.append(systemId);
         }
     }
-    
     return result;
 }
 
 mavsdk::System* QGroundControlStationPrivate::getSystem(uint8_t systemId) const
 {
-    if (!m_mavsdk) {
-        return nullptr;
+    const auto &system = m_systemIndex[systemId];
+    if (system && system->is_connected()) {
+        return system.get();
     }
-    
-    auto systems = m_mavsdk->systems();
-    for (auto system : systems) {
-        if (system->get_system_id() == systemId && system->is_connected()) {
-            return system.get();
+    return nullptr;
+}
+
+QVector<uint8_t> QGroundControlStationPrivate::indexSystems(
+    const std::vector<std::shared_ptr<mavsdk::System>> &systems)
+{
+    QVector<uint8_t> changed;
+    for (const auto &system : systems) {
+        if (!system) {
+            continue;
+        }
+        const uint8_t systemId = system->get_system_id();
+        auto &slot = m_systemIndex[systemId];
+        if (slot == system) {
+            continue;
+        }
+        if (!slot) {
+            m_indexedSystemIds.append(systemId);
         }
+        slot = system;
+        changed.append(systemId);
+    }
+    return changed;
+}
+
+void QGroundControlStationPrivate::handleNewSystems(
+    QGroundControlStation *station,
+    const std::vector<std::shared_ptr<mavsdk::System>> &systems)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QVector<uint8_t> candidates = indexSystems(systems);
+    for (const uint8_t systemId : std::as_const(m_unboundSystemIds)) {
+        if (!candidates.contains(systemId)) {
+            candidates.append(systemId);
+        }
+    }
+    m_unboundSystemIds.clear();
+
+    for (const uint8_t systemId : std::as_const(candidates)) {
+        if (!bindConnectedSystem(station, m_systemIndex[systemId])) {
+            m_unboundSystemIds.append(systemId);
+        }
+    }
+
+    if (spdlog::should_log(spdlog::level::debug)) {
+        spdlog::debug(SYS_FMT_STR, "new system discovery",
+                      fmt::format("systems={} bound={} pending={} elapsed_us={}",
+                                  systems.size(),
+                                  candidates.size() - m_unboundSystemIds.size(),
+                                  m_unboundSystemIds.size(),
+                                  timer.nsecsElapsed() / 1000));
     }
-    
-    return nullptr;
 }
 
 void QGroundControlStationPrivate::setupConnectionErrorHandling(QObject* parent)
@@ -242,49 +401,232 @@ void QGroundControlStationPrivate::setupNewSystemDiscoveryCallback(
         qobject_cast<QGroundControlStation *>(parent);
     std::weak_ptr<mavsdk::Mavsdk> weakMavsdk = m_mavsdk;
     QGroundControlStationPrivate *self = this;
+    /// 集群上线时通知密集到达，处理投递前的多次通知合并为一次
+    const auto discoveryPending = std::make_shared<std::atomic_bool>(false);
 
     // 订阅新系统发现
-    m_newSystemHandle = m_mavsdk->subscribe_on_new_system([station, weakMavsdk, self]() {
-        if (!station) {
+    m_newSystemHandle = m_mavsdk->subscribe_on_new_system(
+        [station, weakMavsdk, self, discoveryPending]() {
+        if (!station || discoveryPending->exchange(true)) {
             return;
         }
-        QMetaObject::invokeMethod(station, [station, weakMavsdk, self]() {
+        QMetaObject::invokeMethod(station, [station, weakMavsdk, self, discoveryPending]() {
+            discoveryPending->store(false);
             const auto mavsdk = weakMavsdk.lock();
             if (!station || !mavsdk || !self) {
                 return;
             }
-            // 获取所有系统
-            auto systems = mavsdk->systems();
+            self->handleNewSystems(station, mavsdk->systems());
+        }, Qt::QueuedConnection);
+    });
+}
 
-            // 检查是否有新系统
-            for (const auto &system : systems) {
-                self->bindConnectedSystem(station, system);
+void QGroundControlStationPrivate::setupTelemetryRatePropagation(
+    QGroundControlStation *station)
+{
+    if (!station) {
+        return;
+    }
+    QObject::connect(
+        QGCSConfig::instance(), &QGCSConfig::settingsChanged, station,
+        [station](const QStringList &keys) {
+            if (!station->d_ptr) {
+                return;
+            }
+            const uint32_t rates =
+                QGCSConfigInternal::telemetryRatesForKeys(keys);
+            if (rates != 0) {
+                station->d_ptr->scheduleTelemetryRates(station, rates);
+            }
+            for (const QString &key : keys) {
+                if (key.startsWith(QLatin1String("Telemetry"))) {
+                    station->d_ptr->scheduleTelemetryBudget(station);
+                    break;
+                }
             }
         });
+}
+
+void QGroundControlStationPrivate::scheduleTelemetryBudget(
+    QGroundControlStation *station)
+{
+    if (!station || m_telemetryBudgetPending) {
+        return;
+    }
+    m_telemetryBudgetPending = true;
+    QTimer::singleShot(0, station, [station]() {
+        if (station->d_ptr) {
+            station->d_ptr->m_telemetryBudgetPending = false;
+            station->d_ptr->rebalanceTelemetryBudget(station);
+        }
     });
 }
 
+void QGroundControlStationPrivate::scheduleTelemetryProfile(
+    QGroundControlStation *station, uint8_t systemId)
+{
+    const auto &system = m_systemIndex[systemId];
+    if (system && system->is_connected()) {
+        m_pendingTelemetryRates[systemId] |=
+            QGCSConfigInternal::TelemetryRateAll;
+        startTelemetryRateTimer(station);
+    }
+    scheduleTelemetryBudget(station);
+}
+
+void QGroundControlStationPrivate::rebalanceTelemetryBudget(
+    QGroundControlStation *station)
+{
+    const double utilization =
+        QGCSConfigInternal::telemetryLinkBudgetUtilization();
+    std::vector<QTelemetryBudget::Link> links;
+    if (utilization > 0.0 && station->m_linkManager &&
+        station->m_linkManager->d_func()) {
+        for (QDataLink *link : station->m_linkManager->d_func()->links()) {
+            if (!link->isOpened() || link->bandwidthBytesPerSecond() <= 0) {
+                continue;
+            }
+            QTelemetryBudget::Link budget;
+            budget.budgetBytesPerSecond =
+                link->bandwidthBytesPerSecond() * utilization;
+            for (const int systemId : link->assignedSystemIds()) {
+                budget.systemIds.push_back(static_cast<uint8_t>(systemId));
+            }
+            links.push_back(std::move(budget));
+        }
+    }
+
+    std::vector<QTelemetryBudget::Vehicle> vehicles;
+    std::vector<QAutopilotPrivate *> autopilots;
+    for (const uint8_t systemId : std::as_const(m_indexedSystemIds)) {
+        const auto &system = m_systemIndex[systemId];
+        auto *autopilot = qobject_cast<QAutopilot *>(
+            station->m_mapId2Standalone.value(systemId, nullptr));
+        if (!system || !system->is_connected() || !autopilot ||
+            !autopilot->d_ptr) {
+            continue;
+        }
+        auto *implementation =
+            static_cast<QAutopilotPrivate *>(autopilot->d_ptr.get());
+        /// 关注中的飞机优先分得预算，地面待机的飞机让出预算
+        double weight = 1.0;
+        switch (autopilot->telemetryProfile()) {
+        case QAutopilot::TelemetryProfileFocused:
+            weight = 4.0;
+            break;
+        case QAutopilot::TelemetryProfileIdleOnGround:
+            weight = 0.25;
+            break;
+        default:
+            break;
+        }
+        vehicles.push_back({systemId,
+                            implementation->telemetryDemandBytesPerSecond(),
+                            weight});
+        autopilots.push_back(implementation);
+    }
+
+    const std::vector<double> scales =
+        QTelemetryBudget::allocate(links, vehicles);
+    int changed = 0;
+    for (std::size_t index = 0; index < autopilots.size(); ++index) {
+        if (autopilots[index]->setTelemetryBudgetScale(scales[index])) {
+            m_pendingTelemetryRates[vehicles[index].systemId] |=
+                QGCSConfigInternal::TelemetryRateAll;
+            ++changed;
+        }
+    }
+    if (changed > 0) {
+        spdlog::info(SYS_FMT_STR, "链路带宽预算变化，待重发飞机数", changed);
+        startTelemetryRateTimer(station);
+    }
+}
+
+void QGroundControlStationPrivate::scheduleTelemetryRates(
+    QGroundControlStation *station, uint32_t rates)
+{
+    for (const uint8_t systemId : std::as_const(m_indexedSystemIds)) {
+        const auto &system = m_systemIndex[systemId];
+        if (system && system->is_connected()) {
+            m_pendingTelemetryRates[systemId] |= rates;
+        }
+    }
+    if (m_pendingTelemetryRates.isEmpty()) {
+        return;
+    }
+    spdlog::info(SYS_FMT_STR, "遥测频率变化，待重发飞机数",
+                 m_pendingTelemetryRates.size());
+    startTelemetryRateTimer(station);
+}
+
+void QGroundControlStationPrivate::startTelemetryRateTimer(
+    QGroundControlStation *station)
+{
+    if (!m_telemetryRateTimer) {
+        m_telemetryRateTimer = new QTimer(station);
+        QObject::connect(m_telemetryRateTimer, &QTimer::timeout, station,
+                         [station]() {
+            if (station->d_ptr) {
+                station->d_ptr->applyNextTelemetryRates(station);
+            }
+        });
+    }
+    m_telemetryRateTimer->setInterval(
+        QGCSConfigInternal::telemetryRateUpdateIntervalMs());
+    if (!m_telemetryRateTimer->isActive()) {
+        m_telemetryRateTimer->start();
+    }
+}
+
+void QGroundControlStationPrivate::applyNextTelemetryRates(
+    QGroundControlStation *station)
+{
+    if (m_pendingTelemetryRates.isEmpty()) {
+        if (m_telemetryRateTimer) {
+            m_telemetryRateTimer->stop();
+        }
+        return;
+    }
+
+    const auto next = m_pendingTelemetryRates.begin();
+    const uint8_t systemId = next.key();
+    const uint32_t rates = next.value();
+    m_pendingTelemetryRates.erase(next);
+
+    QPlat *platform = station->m_mapId2Standalone.value(systemId, nullptr);
+    if (!qobject_cast<QAutopilot *>(platform) || !platform->d_ptr) {
+        return;
+    }
+    static_cast<QAutopilotPrivate *>(platform->d_ptr.get())
+        ->setTelemetryRate(rates);
+}
+
 void QGroundControlStationPrivate::refreshConnectedSystem(
     QGroundControlStation *station, uint8_t systemId)
 {
     if (!station || !m_mavsdk) {
         return;
     }
-    for (const auto &system : m_mavsdk->systems()) {
-        if (system && system->get_system_id() == systemId) {
-            bindConnectedSystem(station, system);
-            return;
-        }
+    auto system = indexedSystem(systemId);
+    if (!system) {
+        /// 发现通知尚未处理时补登记一次
+        indexSystems(m_mavsdk->systems());
+        system = indexedSystem(systemId);
+    }
+    if (system && bindConnectedSystem(station, system)) {
+        m_unboundSystemIds.removeAll(systemId);
     }
 }
 
-void QGroundControlStationPrivate::bindConnectedSystem(
+bool QGroundControlStationPrivate::bindConnectedSystem(
     QGroundControlStation *station,
     const std::shared_ptr<mavsdk::System> &system)
 {
     if (!station || !system || !system->is_connected()) {
-        return;
+        return false;
     }
+    QGCS_TRACE_SCOPE_ID("system", "bindConnectedSystem",
+                        system->get_system_id());
 
     ensureCustomXmlLoaded(system);
     const uint8_t systemId = system->get_system_id();
@@ -293,25 +635,32 @@ void QGroundControlStationPrivate::bindConnectedSystem(
     if (platform->d_ptr && platform->d_ptr->getSystem() == system) {
         // 已绑定同一 System：仅在状态变化时由 syncConnectionStatus 去重发信号
         platform->d_ptr->syncConnectionStatus();
-        return;
+        return true;
     }
 
     QPlatPrivate *implementation = hasAutopilot
         ? static_cast<QPlatPrivate *>(new QAutopilotPrivate(platform))
         : new QPlatPrivate(platform);
     implementation->setMavMessageExtension(m_xmlExtension);
+    implementation->setMessageStats(m_messageStats);
     implementation->setSystem(system);
     platform->SetPrivate(implementation);
     emit station->newPlatFind(platform);
+    scheduleTelemetryBudget(station);
+    return true;
 }
 
-void QGroundControlStationPrivate::processReceivedRawData(const QByteArray &data)
+void QGroundControlStationPrivate::processReceivedRawData(const char *data,
+                                                          int length)
 {
-    if (!m_mavsdk) {
+    if (!m_mavsdk || !data || length <= 0) {
         return;
     }
-    
-    m_mavsdk->pass_received_raw_bytes(data.constData(), data.size());
+
+    if (m_rawTraffic) {
+        m_rawTraffic->scanReceivedBytes(data, static_cast<std::size_t>(length));
+    }
+    m_mavsdk->pass_received_raw_bytes(data, static_cast<size_t>(length));
 }
 
 void QGroundControlStationPrivate::setupRawBytesToBeSentCallback(
@@ -323,24 +672,41 @@ void QGroundControlStationPrivate::setupRawBytesToBeSentCallback(
     /// 取消之前的订阅（如果存在）
     unsubscribeRawBytesToBeSent();
 
-    // 订阅需要发送的原始字节
-    // MAVSDK 回调可能在非主线程中执行，需要通过 QMetaObject::invokeMethod
-    // 确保在主线程中执行
+    /// 订阅需要发送的原始字节
+    /// MAVSDK 回调可能在非主线程中执行；同一事件循环轮次内的字节合并为
+    /// 一个缓冲区，只投递一次并调用一次 callback
+    struct PendingRawBytes {
+        std::mutex mutex;
+        QByteArray buffer;
+        bool flushPending{false};
+    };
+    const auto pending = std::make_shared<PendingRawBytes>();
     QPointer<QObject> context(parent);
     m_rawBytesHandle = m_mavsdk->subscribe_raw_bytes_to_be_sent(
-        [callback, context](const char *bytes, size_t length) {
-            if (bytes && length > 0) {
-                QByteArray data(bytes, static_cast<int>(length));
-                if (!context) {
-                    return;
-                }
-                // 通过 QMetaObject::invokeMethod 确保在主线程中执行 callback
-                QMetaObject::invokeMethod(context, [callback, context, data]() {
-                    if (context && callback) {
-                        callback(data);
-                    }
-                });
+        [callback, context, pending](const char *bytes, size_t length) {
+            if (!bytes || length == 0 || !context) {
+                return;
+            }
+            bool schedule = false;
+            {
+                std::scoped_lock lock(pending->mutex);
+                pending->buffer.append(bytes, static_cast<qsizetype>(length));
+                schedule = !std::exchange(pending->flushPending, true);
+            }
+            if (!schedule) {
+                return;
             }
+            QMetaObject::invokeMethod(context, [callback, context, pending]() {
+                QByteArray data;
+                {
+                    std::scoped_lock lock(pending->mutex);
+                    data.swap(pending->buffer);
+                    pending->flushPending = false;
+                }
+                if (context && callback && !data.isEmpty()) {
+                    callback(data);
+                }
+            }, Qt::QueuedConnection);
         });
 }
 
@@ -382,14 +748,22 @@ bool QGroundControlStationPrivate::addRawConnection(QDataLink *rawDataLink)
     m_connectionHandles["raw://"] = result.second;
     m_rawDataLink = rawDataLink;
     const QPointer<QDataLink> link = m_rawDataLink;
+    const std::shared_ptr<QRawPacketRing> ring = rawDataLink->rawPacketRing();
+    const std::shared_ptr<QLinkTrafficCounters> traffic =
+        rawDataLink->trafficCounters();
+    m_rawTraffic = traffic;
 
+    /// 待发送字节写入链路的环形缓冲区，每批次只通知一次链路线程
     unsubscribeRawBytesToBeSent();
     m_rawBytesHandle = m_mavsdk->subscribe_raw_bytes_to_be_sent(
-        [link](const char *bytes, size_t length) {
-            if (bytes && length > 0 && link) {
-                QByteArray data(bytes, static_cast<int>(length));
-                QMetaObject::invokeMethod(link, "emitRawDataReceived",
-                    Qt::QueuedConnection, Q_ARG(QByteArray, data));
+        [link, ring, traffic](const char *bytes, size_t length) {
+            bool notify = false;
+            if (!ring || !ring->push(bytes, length, &notify)) {
+                return;
+            }
+            traffic->recordSentPacket(length);
+            if (notify) {
+                QQueuedInvoke::post(link, &QDataLink::handleRawDataReady);
             }
         });
     return true;
@@ -401,6 +775,7 @@ void QGroundControlStationPrivate::removeConnection(const QString &connectionUrl
     std::string url = connectionUrl.toStdString();
     if (url == "raw://") {
         m_rawDataLink = nullptr;
+        m_rawTraffic.reset();
         unsubscribeRawBytesToBeSent();
     }
     auto it = m_connectionHandles.find(url);
@@ -6,9 +6,15 @@
 #include <QMap>
 #include <QPointer>
 #include <QVector>
+#include <QTimer>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <mavsdk/mavsdk.h>
 #include <mavsdk/system.h>
 
@@ -17,6 +23,8 @@ struct ConnectionConfig;
 class QPlat;
 class QGroundControlStation;
 class XmlToMavSDK;
+class QLinkTrafficCounters;
+class QMavlinkMessageStats;
 
 /**
  * @brief QGroundControlStation的私有实现类
@@ -66,6 +74,36 @@ public:
      */
     void setupNewSystemDiscoveryCallback(QObject* parent);
 
+    /**
+     * @brief 订阅配置变化，将变化的遥测频率逐架重发给已连接飞机
+     *
+     * 只重发变化键对应的 set_rate_* 请求；每隔
+     * Telemetry/RateUpdateIntervalMs 处理一架，避免整队同时下发命令。
+     */
+    void setupTelemetryRatePropagation(QGroundControlStation *station);
+
+    /**
+     * @brief 合并同一事件循环轮次内的请求，按链路带宽重新分配遥测频率
+     *
+     * 链路开闭、带宽或归属变化，飞机上下线、档位变化以及遥测配置变化时调用。
+     */
+    void scheduleTelemetryBudget(QGroundControlStation *station);
+
+    /**
+     * @brief 飞机切换档位后排队重发其全部频率并重算预算
+     *
+     * 预算倍数随之变化时只合并进同一队列项，每次切换只下发一轮 set_rate。
+     */
+    void scheduleTelemetryProfile(QGroundControlStation *station,
+                                  uint8_t systemId);
+
+    /**
+     * @brief 按当前链路与 assignedSystemIds 重建流量统计的归属表
+     *
+     * MAVSDK 管理的链路经消息拦截回调计数；Raw 链路在喂入/取出字节时自行计数。
+     */
+    void refreshLinkTrafficRoutes(QGroundControlStation *station);
+
     /**
      * @brief 组件集合变化后重新判断平台是否具备 autopilot 能力
      */
@@ -79,14 +117,16 @@ public:
     void setupSystemConnectionCallbacks(QObject* parent);
 
     /**
-     * @brief 处理接收到的原始数据
+     * @brief 处理接收到的原始数据（直接交给 MAVSDK 解析，不复制）
      * @param data 接收到的原始数据
+     * @param length 数据长度
      */
-    void processReceivedRawData(const QByteArray &data);
+    void processReceivedRawData(const char *data, int length);
 
     /**
      * @brief 设置发送原始字节的回调
-     * @param callback 回调函数，用于将数据发送到所有DataLink
+     * @param callback 回调函数，用于将数据发送到所有DataLink；
+     *        同一事件循环轮次内的字节合并后只调用一次
      * @param parent QGroundControlStation实例指针，用于确保线程安全
      */
     void setupRawBytesToBeSentCallback(std::function<void(const QByteArray&)> callback, QObject* parent);
@@ -137,14 +177,63 @@ private:
         const mavsdk::Mavsdk::ConnectionError &error,
         QGroundControlStation *station);
 
+    /**
+     * @brief 将 MAVSDK 系统列表中尚未登记的系统写入索引表
+     * @return 新登记或 System 对象发生替换的系统 ID
+     */
+    QVector<uint8_t> indexSystems(
+        const std::vector<std::shared_ptr<mavsdk::System>> &systems);
+
+    /**
+     * @brief 处理一次（可能合并了多次的）新系统通知
+     *
+     * 只绑定新出现的系统以及此前因未连接而未绑定的系统，已绑定系统的
+     * 连接状态由各自的 QPlatPrivate 订阅维护。
+     */
+    void handleNewSystems(QGroundControlStation *station,
+                          const std::vector<std::shared_ptr<mavsdk::System>> &systems);
+    std::shared_ptr<mavsdk::System> indexedSystem(uint8_t systemId) const
+    {
+        return m_systemIndex[systemId];
+    }
+
     /**
      * @brief 在首个可用 System 上将扩展 XML 注入 MAVSDK（只执行一次）
      */
     void ensureCustomXmlLoaded(const std::shared_ptr<mavsdk::System> &system);
-    void bindConnectedSystem(
+
+    /**
+     * @brief 安装 MAVSDK 收发消息拦截回调，累计链路流量与按系统的消息计数
+     */
+    void setupLinkTrafficInterception();
+    /**
+     * @brief 为已连接的 System 创建或刷新 QPlat 绑定
+     * @return 是否已绑定（未连接时返回 false）
+     */
+    bool bindConnectedSystem(
         QGroundControlStation *station,
         const std::shared_ptr<mavsdk::System> &system);
 
+    /**
+     * @brief 将频率位合并进所有已连接系统的待发队列并启动节拍
+     */
+    void scheduleTelemetryRates(QGroundControlStation *station, uint32_t rates);
+
+    /**
+     * @brief 启动逐架下发待发频率的节拍
+     */
+    void startTelemetryRateTimer(QGroundControlStation *station);
+
+    /**
+     * @brief 节拍到达时取出一架飞机并下发其待发频率
+     */
+    void applyNextTelemetryRates(QGroundControlStation *station);
+
+    /**
+     * @brief 计算各飞机的预算倍数，倍数变化的飞机进入频率重发队列
+     */
+    void rebalanceTelemetryBudget(QGroundControlStation *station);
+
     std::shared_ptr<mavsdk::Mavsdk> m_mavsdk;        ///< MAVSDK实例
     bool m_isInitialized;                            ///< 是否已初始化
     std::shared_ptr<XmlToMavSDK> m_xmlExtension;     ///< APM 扩展命令/消息
@@ -155,6 +244,36 @@ private:
     mavsdk::Mavsdk::RawBytesHandle m_rawBytesHandle;
     mavsdk::Mavsdk::ConnectionErrorHandle m_connectionErrorHandle;
     QPointer<class QDataLink> m_rawDataLink;  ///< Raw 模式下的数据链路，用于接收回调
+    std::shared_ptr<QLinkTrafficCounters> m_rawTraffic; ///< Raw 链路的流量计数
+
+    struct LinkTrafficRoute {
+        std::shared_ptr<QLinkTrafficCounters> counters;
+        std::vector<uint8_t> systemIds; ///< 为空表示全部系统，仅用于唯一的连接
+
+        bool reaches(uint8_t systemId) const
+        {
+            return systemIds.empty() ||
+                   std::find(systemIds.begin(), systemIds.end(), systemId) !=
+                       systemIds.end();
+        }
+    };
+    struct LinkTrafficRoutes {
+        /// 只读快照，地面站线程整体替换，MAVSDK 收发线程不加锁读取
+        std::atomic<std::shared_ptr<const std::vector<LinkTrafficRoute>>>
+            current;
+    };
+    std::shared_ptr<LinkTrafficRoutes> m_trafficRoutes;
+    /// 按系统、消息 ID 的接收计数，在接收拦截回调中累计
+    std::shared_ptr<QMavlinkMessageStats> m_messageStats;
+
+    /// 系统 ID -> System 索引表，仅在地面站线程访问
+    std::array<std::shared_ptr<mavsdk::System>, 256> m_systemIndex;
+    QVector<uint8_t> m_indexedSystemIds;      ///< 已登记的系统 ID（发现顺序）
+    QVector<uint8_t> m_unboundSystemIds;      ///< 已登记但尚未连接绑定的系统 ID
+
+    QPointer<QTimer> m_telemetryRateTimer;    ///< 遥测频率重发节拍（地面站线程）
+    QMap<uint8_t, uint32_t> m_pendingTelemetryRates; ///< 系统 ID -> 待发频率位
+    bool m_telemetryBudgetPending{false};     ///< 已排队一次预算重算
 };
 
 #endif // QGROUNDCONTROLSTATIONPRIVATE_H
@@ -0,0 +1,74 @@
+#include "Private/QLatencyHistogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+std::size_t QLatencyHistogram::bucketIndex(int64_t latencyUs)
+{
+    const uint64_t value = static_cast<uint64_t>(std::max<int64_t>(0, latencyUs));
+    if (value < SubBuckets) {
+        return static_cast<std::size_t>(value);
+    }
+    const int exponent = std::bit_width(value) - 1;
+    if (exponent >= MaxExponent) {
+        return BucketCount - 1;
+    }
+    const uint64_t sub =
+        (value >> (exponent - SubBucketBits)) & (SubBuckets - 1);
+    return static_cast<std::size_t>(
+        SubBuckets + (exponent - SubBucketBits) * SubBuckets + sub);
+}
+
+int64_t QLatencyHistogram::bucketMidpoint(std::size_t index)
+{
+    if (index < SubBuckets) {
+        return static_cast<int64_t>(index);
+    }
+    const int exponent =
+        static_cast<int>((index - SubBuckets) / SubBuckets) + SubBucketBits;
+    const uint64_t sub = (index - SubBuckets) % SubBuckets;
+    const int shift = exponent - SubBucketBits;
+    const uint64_t lower = (SubBuckets + sub) << shift;
+    return static_cast<int64_t>(lower + ((uint64_t{1} << shift) >> 1));
+}
+
+void QLatencyHistogram::record(int64_t latencyUs)
+{
+    latencyUs = std::max<int64_t>(0, latencyUs);
+    ++m_buckets[bucketIndex(latencyUs)];
+    m_minUs = m_count ? std::min(m_minUs, latencyUs) : latencyUs;
+    m_maxUs = std::max(m_maxUs, latencyUs);
+    m_sumUs += latencyUs;
+    ++m_count;
+}
+
+void QLatencyHistogram::reset()
+{
+    m_buckets.fill(0);
+    m_count = 0;
+    m_sumUs = 0;
+    m_minUs = 0;
+    m_maxUs = 0;
+}
+
+int64_t QLatencyHistogram::percentileUs(double quantile) const
+{
+    if (m_count == 0) {
+        return 0;
+    }
+    quantile = std::clamp(quantile, 0.0, 1.0);
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(quantile * m_count)));
+    uint64_t seen = 0;
+    for (std::size_t index = 0; index < BucketCount; ++index) {
+        seen += m_buckets[index];
+        if (seen >= rank) {
+            /// 溢出桶没有上界，直接取最大值
+            return index == BucketCount - 1
+                ? m_maxUs
+                : std::clamp(bucketMidpoint(index), m_minUs, m_maxUs);
+        }
+    }
+    return m_maxUs;
+}
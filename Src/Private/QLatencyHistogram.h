@@ -0,0 +1,52 @@
+#ifndef QLATENCYHISTOGRAM_H
+#define QLATENCYHISTOGRAM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 对数-线性分桶的延迟直方图（HDR 风格）
+ *
+ * 以微秒为单位：16 µs 以下每微秒一桶，之后每个 2 的幂区间再等分 16 桶，
+ * 相对误差不超过 1/16。存储固定，记录一次只做几次整数运算；
+ * 实例只在单个线程上使用。
+ */
+class QLatencyHistogram
+{
+public:
+    static constexpr int SubBuckets = 16;
+    static constexpr int SubBucketBits = 4;
+    /// 覆盖到 2^36 µs（约 19 小时），更大的值计入最后一桶
+    static constexpr int MaxExponent = 36;
+    static constexpr std::size_t BucketCount =
+        SubBuckets + (MaxExponent - SubBucketBits) * SubBuckets;
+
+    void record(int64_t latencyUs);
+    void reset();
+
+    uint64_t count() const { return m_count; }
+    int64_t minUs() const { return m_count ? m_minUs : 0; }
+    int64_t maxUs() const { return m_maxUs; }
+    double meanUs() const
+    {
+        return m_count ? static_cast<double>(m_sumUs) / m_count : 0.0;
+    }
+
+    /**
+     * @brief 分位数（0–1），返回所在桶的中点，并限制在 [min, max] 内
+     */
+    int64_t percentileUs(double quantile) const;
+
+private:
+    static std::size_t bucketIndex(int64_t latencyUs);
+    static int64_t bucketMidpoint(std::size_t index);
+
+    std::array<uint64_t, BucketCount> m_buckets{};
+    uint64_t m_count{0};
+    int64_t m_sumUs{0};
+    int64_t m_minUs{0};
+    int64_t m_maxUs{0};
+};
+
+#endif // QLATENCYHISTOGRAM_H
@@ -2,84 +2,312 @@
 
 #include "QGCSConfig.h"
 
-#include <QDateTime>
+#include <QCoreApplication>
 #include <QFile>
 #include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QHash>
 #include <QJsonDocument>
 #include <QJsonObject>
-#include <QMutex>
-#include <QMutexLocker>
+#include <QPointer>
 #include <QDebug>
 
+#include <array>
+#include <atomic>
+#include <climits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 namespace {
-struct CatalogCache
+/// 整数键跨度不超过该值时按数组存放
+constexpr qint64 MaxDenseSpan = 4096;
+
+constexpr std::array<QStringView, QMavsdkTextCatalog::SectionCount>
+    SectionNames = {
+        u"vehicle",
+        u"autopilot",
+        u"vehicleIcon",
+        u"command",
+        u"missionPointAction",
+        u"gpsFixType",
+        u"missionResult",
+        u"flightSoftwareVersionType",
+        u"flightMode",
+        u"landedState",
+        u"batteryFunction",
+        u"actionResult",
+        u"commandAckResult",
+};
+
+struct SectionTable
 {
-    QMutex mutex;
-    QString path;
-    QDateTime lastModified;
-    qint64 size{-1};
-    QJsonObject root;
+    int denseBase{0};
+    std::vector<std::optional<QString>> dense;
+    QHash<QString, QString> keys;
+    std::optional<QString> fallback;
+
+    const QString *find(int value) const
+    {
+        const qint64 index = static_cast<qint64>(value) - denseBase;
+        if (index >= 0 && index < static_cast<qint64>(dense.size()) &&
+            dense[static_cast<std::size_t>(index)]) {
+            return &*dense[static_cast<std::size_t>(index)];
+        }
+        if (!keys.isEmpty()) {
+            const auto it = keys.constFind(QString::number(value));
+            if (it != keys.constEnd()) {
+                return &it.value();
+            }
+        }
+        return fallback ? &*fallback : nullptr;
+    }
+
+    const QString *find(const QString &key) const
+    {
+        bool isInt = false;
+        const int value = key.toInt(&isInt);
+        if (isInt) {
+            return find(value);
+        }
+        const auto it = keys.constFind(key);
+        if (it != keys.constEnd()) {
+            return &it.value();
+        }
+        return fallback ? &*fallback : nullptr;
+    }
 };
 
-CatalogCache &catalogCache()
+/**
+ * @brief 编译后的只读文本表，发布后不再修改
+ */
+struct TextTable
 {
-    static CatalogCache cache;
-    return cache;
+    QHash<QString, SectionTable> sections;
+    std::array<const SectionTable *, QMavsdkTextCatalog::SectionCount> known{};
+};
+
+struct CatalogState
+{
+    std::atomic<const TextTable *> current{nullptr};
+    std::mutex mutex;
+    /// 发布过的表保留到进程结束，读者无需引用计数；只在文件内容变化时重建
+    std::vector<std::unique_ptr<const TextTable>> published;
+    /// 当前表的来源，用于判断 reload() 是否需要重建
+    QString sourcePath;
+    QByteArray sourceData;
+    bool sourceReadable{false};
+};
+
+CatalogState &catalogState()
+{
+    static CatalogState state;
+    return state;
 }
 
-void reloadIfChanged(CatalogCache &cache, const QString &path)
+SectionTable compileSection(const QJsonObject &entries)
 {
-    const QFileInfo info(path);
-    if (cache.path == info.absoluteFilePath() &&
-        cache.lastModified == info.lastModified() &&
-        cache.size == info.size()) {
-        return;
+    SectionTable section;
+    qint64 minKey = LLONG_MAX;
+    qint64 maxKey = LLONG_MIN;
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        bool isInt = false;
+        const int value = it.key().toInt(&isInt);
+        if (isInt && it.value().isString()) {
+            minKey = qMin<qint64>(minKey, value);
+            maxKey = qMax<qint64>(maxKey, value);
+        }
+    }
+    const bool useDense = minKey <= maxKey && maxKey - minKey < MaxDenseSpan;
+    if (useDense) {
+        section.denseBase = static_cast<int>(minKey);
+        section.dense.resize(static_cast<std::size_t>(maxKey - minKey + 1));
     }
 
-    cache.path = info.absoluteFilePath();
-    cache.lastModified = info.lastModified();
-    cache.size = info.size();
-    cache.root = {};
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (!it.value().isString()) {
+            continue;
+        }
+        const QString text = it.value().toString();
+        if (it.key() == QLatin1String("default")) {
+            section.fallback = text;
+            continue;
+        }
+        bool isInt = false;
+        const int value = it.key().toInt(&isInt);
+        if (isInt && useDense) {
+            section.dense[static_cast<std::size_t>(value - minKey)] = text;
+        } else {
+            section.keys.insert(it.key(), text);
+        }
+    }
+    return section;
+}
 
-    QFile file(path);
-    if (!file.open(QIODevice::ReadOnly)) {
+/**
+ * @param data 文件内容；文件无法读取时为 nullptr
+ */
+std::unique_ptr<TextTable> compileTable(const QString &path,
+                                        const QByteArray *data)
+{
+    auto table = std::make_unique<TextTable>();
+
+    if (!data) {
         qWarning() << "无法读取 MAVSDK 类型文本文件:" << path;
-        return;
+    } else {
+        QJsonParseError error;
+        const QJsonDocument document = QJsonDocument::fromJson(*data, &error);
+        if (error.error != QJsonParseError::NoError || !document.isObject()) {
+            qWarning() << "MAVSDK 类型文本文件格式错误:" << path
+                       << error.errorString();
+        } else {
+            const QJsonObject root = document.object();
+            for (auto it = root.begin(); it != root.end(); ++it) {
+                if (it.value().isObject()) {
+                    table->sections.insert(
+                        it.key(), compileSection(it.value().toObject()));
+                }
+            }
+        }
     }
 
-    QJsonParseError error;
-    const QJsonDocument document =
-        QJsonDocument::fromJson(file.readAll(), &error);
-    if (error.error != QJsonParseError::NoError || !document.isObject()) {
-        qWarning() << "MAVSDK 类型文本文件格式错误:" << path
-                   << error.errorString();
+    for (int index = 0; index < QMavsdkTextCatalog::SectionCount; ++index) {
+        const auto it = table->sections.constFind(
+            SectionNames[static_cast<std::size_t>(index)].toString());
+        table->known[static_cast<std::size_t>(index)] =
+            it != table->sections.constEnd() ? &it.value() : nullptr;
+    }
+    return table;
+}
+
+/**
+ * @brief 在应用主线程上监视类型文本文件；文件被替换后重新加入监视
+ */
+void watchFile(const QString &path)
+{
+    QCoreApplication *app = QCoreApplication::instance();
+    if (!app) {
         return;
     }
-    cache.root = document.object();
+    QMetaObject::invokeMethod(app, [app, path]() {
+        static QPointer<QFileSystemWatcher> watcher;
+        if (!watcher) {
+            watcher = new QFileSystemWatcher(app);
+            QObject::connect(watcher, &QFileSystemWatcher::fileChanged,
+                             watcher, [](const QString &) {
+                QMavsdkTextCatalog::reload();
+            });
+        }
+        const QStringList watched = watcher->files();
+        if (!watched.isEmpty()) {
+            watcher->removePaths(watched);
+        }
+        if (QFileInfo::exists(path)) {
+            watcher->addPath(path);
+        }
+    }, Qt::QueuedConnection);
+}
+
+const TextTable *publishTable(bool force)
+{
+    CatalogState &state = catalogState();
+    std::scoped_lock lock(state.mutex);
+    const TextTable *current = state.current.load(std::memory_order_acquire);
+    if (current && !force) {
+        return current;
+    }
+
+    const QString path = QGCSConfig::instance()->typeTextFile();
+    QFile file(path);
+    const bool readable = file.open(QIODevice::ReadOnly);
+    const QByteArray data = readable ? file.readAll() : QByteArray();
+    watchFile(QFileInfo(path).absoluteFilePath());
+    if (current && path == state.sourcePath &&
+        readable == state.sourceReadable && data == state.sourceData) {
+        return current;
+    }
+
+    std::unique_ptr<TextTable> table =
+        compileTable(path, readable ? &data : nullptr);
+    const TextTable *published = table.get();
+    state.published.push_back(std::move(table));
+    state.sourcePath = path;
+    state.sourceData = data;
+    state.sourceReadable = readable;
+    state.current.store(published, std::memory_order_release);
+    return published;
+}
+
+const TextTable &currentTable()
+{
+    const TextTable *table =
+        catalogState().current.load(std::memory_order_acquire);
+    return table ? *table : *publishTable(false);
+}
+
+std::optional<QMavsdkTextCatalog::Section> sectionFromName(QStringView name)
+{
+    for (int index = 0; index < QMavsdkTextCatalog::SectionCount; ++index) {
+        if (SectionNames[static_cast<std::size_t>(index)] == name) {
+            return static_cast<QMavsdkTextCatalog::Section>(index);
+        }
+    }
+    return std::nullopt;
+}
+
+QString missingText(QStringView section, QStringView key)
+{
+    return QStringLiteral("%1(%2)").arg(section, key);
 }
 } // namespace
 
+QStringView QMavsdkTextCatalog::sectionName(Section section)
+{
+    return section >= 0 && section < SectionCount
+        ? SectionNames[static_cast<std::size_t>(section)]
+        : QStringView();
+}
+
+const QString *QMavsdkTextCatalog::find(Section section, int value)
+{
+    if (section < 0 || section >= SectionCount) {
+        return nullptr;
+    }
+    const SectionTable *entries =
+        currentTable().known[static_cast<std::size_t>(section)];
+    return entries ? entries->find(value) : nullptr;
+}
+
+QString QMavsdkTextCatalog::text(Section section, int value)
+{
+    if (const QString *found = find(section, value)) {
+        return *found;
+    }
+    return missingText(sectionName(section), QString::number(value));
+}
+
 QString QMavsdkTextCatalog::text(QStringView section, int value)
 {
+    if (const auto known = sectionFromName(section)) {
+        return text(*known, value);
+    }
     return text(section, QString::number(value));
 }
 
 QString QMavsdkTextCatalog::text(QStringView section, QStringView key)
 {
-    CatalogCache &cache = catalogCache();
-    QMutexLocker locker(&cache.mutex);
-    reloadIfChanged(cache, QGCSConfig::instance()->typeTextFile());
-
-    const QString sectionName = section.toString();
-    const QJsonObject entries = cache.root.value(sectionName).toObject();
-    const QJsonValue exact = entries.value(key.toString());
-    if (exact.isString()) {
-        return exact.toString();
+    const TextTable &table = currentTable();
+    const auto it = table.sections.constFind(section.toString());
+    if (it != table.sections.constEnd()) {
+        if (const QString *found = it.value().find(key.toString())) {
+            return *found;
+        }
     }
+    return missingText(section, key);
+}
 
-    const QJsonValue fallback = entries.value(QStringLiteral("default"));
-    if (fallback.isString()) {
-        return fallback.toString();
-    }
-    return QStringLiteral("%1(%2)").arg(sectionName, key.toString());
+void QMavsdkTextCatalog::reload()
+{
+    publishTable(true);
 }
@@ -4,11 +4,52 @@
 #include <QString>
 #include <QStringView>
 
+/**
+ * @brief MAVSDK 类型文本目录
+ *
+ * 类型文本 JSON 在加载时编译为只读查找表并通过原子指针发布，
+ * 查询只做一次指针读取和数组下标/哈希查找，不加锁、不访问文件系统，
+ * 可在任意线程调用。文件变化由应用主线程上的文件监视器检测后重建。
+ */
 class QMavsdkTextCatalog
 {
 public:
+    /**
+     * @brief 常用分区；与 JSON 顶层键一一对应
+     */
+    enum Section {
+        Vehicle,
+        Autopilot,
+        VehicleIcon,
+        Command,
+        MissionPointAction,
+        GpsFixType,
+        MissionResult,
+        FlightSoftwareVersionType,
+        FlightMode,
+        LandedState,
+        BatteryFunction,
+        ActionResult,
+        CommandAckResult,
+        SectionCount
+    };
+
+    static QString text(Section section, int value);
     static QString text(QStringView section, int value);
     static QString text(QStringView section, QStringView key);
+
+    /**
+     * @brief 查找文本（含分区的 default 项）
+     * @return 未配置时返回 nullptr；指针在进程内一直有效
+     */
+    static const QString *find(Section section, int value);
+
+    static QStringView sectionName(Section section);
+
+    /**
+     * @brief 按当前配置的文件路径重新编译查找表
+     */
+    static void reload();
 };
 
 #endif // QMAVSDKTEXTCATALOG_H
@@ -0,0 +1,31 @@
+#ifndef QQUEUEDINVOKE_H
+#define QQUEUEDINVOKE_H
+
+#include <QMetaObject>
+#include <QPointer>
+#include <utility>
+
+/**
+ * @brief 跨线程的类型化槽投递
+ *
+ * 直接使用成员函数指针投递排队调用：目标方法与参数类型在编译期确定，
+ * 省去按名称查找元方法与 Q_ARG 装箱；目标对象已销毁时直接丢弃。
+ * 私有槽的成员函数指针需在具有访问权限的作用域（如友元类的成员函数
+ * 或其中的 lambda）内取得。
+ */
+namespace QQueuedInvoke {
+
+template<typename T, typename Slot, typename... Args>
+inline bool post(const QPointer<T> &target, Slot slot, Args &&...args)
+{
+    if (!target) {
+        return false;
+    }
+    return QMetaObject::invokeMethod(target.data(), slot,
+                                     Qt::QueuedConnection,
+                                     std::forward<Args>(args)...);
+}
+
+} // namespace QQueuedInvoke
+
+#endif // QQUEUEDINVOKE_H
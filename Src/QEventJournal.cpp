@@ -0,0 +1,79 @@
+#include "QEventJournal.h"
+#include "Private/QGCSJournal.h"
+
+#include <QFile>
+#include <cstring>
+
+QString QEventJournal::activeFile()
+{
+    return QGCSJournal::activeFile();
+}
+
+QList<QJournalEvent> QEventJournal::read(const QString &path, int systemId,
+                                         qint64 fromMs, qint64 toMs)
+{
+    using QGCSJournal::FileHeader;
+    using QGCSJournal::Record;
+
+    QList<QJournalEvent> events;
+    QFile file(path.isEmpty() ? activeFile() : path);
+    if (file.fileName().isEmpty() || !file.open(QIODevice::ReadOnly) ||
+        file.size() < static_cast<qint64>(sizeof(FileHeader))) {
+        return events;
+    }
+    uchar *data = file.map(0, file.size());
+    if (!data) {
+        return events;
+    }
+
+    /// 映射只读；原子读取不写内存
+    auto *header = reinterpret_cast<FileHeader *>(data);
+    const uint32_t capacity = header->capacity;
+    if (std::memcmp(header->magic, QGCSJournal::Magic,
+                    sizeof(QGCSJournal::Magic)) != 0 ||
+        header->version != QGCSJournal::FormatVersion ||
+        header->recordSize != sizeof(Record) || capacity == 0 ||
+        file.size() < static_cast<qint64>(sizeof(FileHeader)) +
+                          static_cast<qint64>(capacity) *
+                              static_cast<qint64>(sizeof(Record))) {
+        file.unmap(data);
+        return events;
+    }
+
+    auto *records = reinterpret_cast<Record *>(data + sizeof(FileHeader));
+    const uint64_t nextSequence =
+        std::atomic_ref<uint64_t>(header->nextSequence)
+            .load(std::memory_order_acquire);
+    const uint64_t firstSequence =
+        nextSequence > capacity ? nextSequence - capacity : 1;
+    for (uint64_t sequence = firstSequence; sequence < nextSequence;
+         ++sequence) {
+        Record &slot = records[(sequence - 1) % capacity];
+        std::atomic_ref<uint64_t> slotSequence(slot.sequence);
+        if (slotSequence.load(std::memory_order_acquire) != sequence) {
+            continue;
+        }
+        Record record;
+        std::memcpy(&record, &slot, sizeof(record));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        /// 拷贝期间被写入方覆盖则丢弃
+        if (slotSequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+        if ((systemId >= 0 && record.systemId != systemId) ||
+            record.timestampMs < fromMs || record.timestampMs > toMs) {
+            continue;
+        }
+        QJournalEvent event;
+        event.setSequence(sequence);
+        event.setTimestampMs(record.timestampMs);
+        event.setSystemId(record.systemId);
+        event.setComponentId(record.componentId);
+        event.setType(static_cast<QJournalEvent::Type>(record.type));
+        event.setCode(record.code);
+        event.setValue(record.value);
+        events.append(event);
+    }
+    file.unmap(data);
+    return events;
+}
@@ -4,15 +4,26 @@
 #include <QDir>
 #include <QSettings>
 #include <QFileInfo>
+#include <QFileSystemWatcher>
 #include <QPointer>
+#include <QTimer>
 #include <QVariant>
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <filesystem>
+#include <memory>
 #include <mutex>
+#include <string_view>
 #include <vector>
 #include "QGCSConfig.h"
 #include "Private/QGCSConfigInternal.h"
+#include "Private/QGCSConfigSnapshot.h"
+#include "Private/QGCSJournal.h"
+#include "Private/QGCSTrace.h"
 #include "Private/QMavsdkTextCatalog.h"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/daily_file_sink.h>
 #include <spdlog/sinks/base_sink.h>
 #include "Private/QGCSLog.h"
@@ -23,6 +34,9 @@ namespace {
 const char *KEY_GCS_SYSTEM_ID = "GCS/SystemId";
 const char *KEY_GCS_COMPONENT_ID = "GCS/ComponentId";
 const char *KEY_LOG_LEVEL = "Logging/Level";
+const char *KEY_LOG_ASYNC = "Logging/Async";
+const char *KEY_LOG_QUEUE_SIZE = "Logging/QueueSize";
+const char *KEY_LOG_OVERFLOW_POLICY = "Logging/OverflowPolicy";
 const char *KEY_MESSAGE_EXTENSION = "MessageExtension/File";
 const char *KEY_MESSAGE_EXTENSION_LEGACY = "MavMessage/Extension";
 const char *KEY_TYPE_TEXT_FILE = "TypeText/File";
@@ -48,11 +62,35 @@ const char *KEY_TELEMETRY_HEALTH_HZ = "Telemetry/HealthHz";
 const char *KEY_TELEMETRY_HOME_HZ = "Telemetry/HomeHz";
 const char *KEY_TELEMETRY_FIXEDWING_METRICS_HZ =
     "Telemetry/FixedwingMetricsHz";
+const char *KEY_TELEMETRY_FLUSH_INTERVAL_MS = "Telemetry/FlushIntervalMs";
+const char *KEY_TELEMETRY_WORKER_THREADS = "Telemetry/WorkerThreads";
+const char *KEY_TELEMETRY_RATE_UPDATE_INTERVAL_MS =
+    "Telemetry/RateUpdateIntervalMs";
+const char *KEY_TELEMETRY_DEMAND_DRIVEN = "Telemetry/DemandDriven";
+const char *KEY_TELEMETRY_LINK_BUDGET_UTILIZATION =
+    "Telemetry/LinkBudgetUtilization";
+const char *KEY_TRACE_GROUP = "Trace/";
+const char *KEY_TRACE_FILE = "Trace/File";
+const char *KEY_TRACE_MAX_EVENTS = "Trace/MaxEvents";
+const char *KEY_JOURNAL_GROUP = "Journal/";
+const char *KEY_JOURNAL_FILE = "Journal/File";
+const char *KEY_JOURNAL_CAPACITY = "Journal/Capacity";
+const char *KEY_TELEMETRY_PROFILE_GROUP = "TelemetryProfile/";
+const char *KEY_TELEMETRY_PROFILE_FOCUSED_SCALE = "TelemetryProfile/FocusedScale";
+const char *KEY_TELEMETRY_PROFILE_BACKGROUND_SCALE =
+    "TelemetryProfile/BackgroundScale";
+const char *KEY_TELEMETRY_PROFILE_IDLE_ON_GROUND_SCALE =
+    "TelemetryProfile/IdleOnGroundScale";
 
 // 默认值
 const uint8_t DEFAULT_GCS_SYSTEM_ID = 246;
 const uint8_t DEFAULT_GCS_COMPONENT_ID = 191;
 const char *DEFAULT_LOG_LEVEL = "debug";
+const bool DEFAULT_LOG_ASYNC = true;
+constexpr int DEFAULT_LOG_QUEUE_SIZE = 8192;
+const char *DEFAULT_LOG_OVERFLOW_POLICY = "overrun";
+/// 固件 STATUSTEXT 使用独立记录器写同一组 sink，已由 firmwareWarningMessage 送达界面
+const char *FIRMWARE_LOGGER_NAME = "firmware";
 const char *DEFAULT_MESSAGE_EXTENSION = "ardupilotmega.xml";
 const char *DEFAULT_TYPE_TEXT_FILE = "type_text_zh_CN.json";
 const char *DEFAULT_TYPE_TEXT_FILE_LEGACY = "mavsdk_zh_CN.json";
@@ -74,6 +112,46 @@ constexpr double DEFAULT_TELEMETRY_LANDED_STATE_HZ = 1.0;
 constexpr double DEFAULT_TELEMETRY_HEALTH_HZ = 0.5;
 constexpr double DEFAULT_TELEMETRY_HOME_HZ = 0.1;
 constexpr double DEFAULT_TELEMETRY_FIXEDWING_METRICS_HZ = 1.0;
+constexpr int DEFAULT_TELEMETRY_FLUSH_INTERVAL_MS = 33;
+constexpr int DEFAULT_TELEMETRY_WORKER_THREADS = 0;
+constexpr int DEFAULT_TELEMETRY_RATE_UPDATE_INTERVAL_MS = 20;
+const bool DEFAULT_TELEMETRY_DEMAND_DRIVEN = true;
+constexpr double DEFAULT_TELEMETRY_LINK_BUDGET_UTILIZATION = 0.7;
+constexpr double DEFAULT_TELEMETRY_PROFILE_FOCUSED_SCALE = 1.0;
+constexpr double DEFAULT_TELEMETRY_PROFILE_BACKGROUND_SCALE = 0.2;
+constexpr double DEFAULT_TELEMETRY_PROFILE_IDLE_ON_GROUND_SCALE = 0.1;
+const char *DEFAULT_TRACE_FILE = "";
+constexpr int DEFAULT_TRACE_MAX_EVENTS = 200000;
+const char *DEFAULT_JOURNAL_FILE = "data/log/minigcs.journal";
+/// 每条 32 字节，默认约 2 MB
+constexpr int DEFAULT_JOURNAL_CAPACITY = 65536;
+/// 编辑器保存时常连续触发多次写入，合并后再重新加载
+constexpr int CONFIG_RELOAD_DEBOUNCE_MS = 200;
+
+/**
+ * @brief 遥测频率键与 set_rate_* 位的对应关系
+ */
+struct TelemetryRateKey
+{
+    const char *key;
+    uint32_t rate;
+};
+
+const TelemetryRateKey TELEMETRY_RATE_KEYS[] = {
+    {KEY_TELEMETRY_POSITION_HZ, QGCSConfigInternal::TelemetryRatePosition},
+    {KEY_TELEMETRY_POSITION_VELOCITY_NED_HZ,
+     QGCSConfigInternal::TelemetryRatePositionVelocityNed},
+    {KEY_TELEMETRY_GPS_INFO_HZ, QGCSConfigInternal::TelemetryRateGpsInfo},
+    {KEY_TELEMETRY_BATTERY_HZ, QGCSConfigInternal::TelemetryRateBattery},
+    {KEY_TELEMETRY_RAW_GPS_HZ, QGCSConfigInternal::TelemetryRateRawGps},
+    {KEY_TELEMETRY_ATTITUDE_HZ, QGCSConfigInternal::TelemetryRateAttitude},
+    {KEY_TELEMETRY_LANDED_STATE_HZ,
+     QGCSConfigInternal::TelemetryRateLandedState},
+    {KEY_TELEMETRY_HEALTH_HZ, QGCSConfigInternal::TelemetryRateHealth},
+    {KEY_TELEMETRY_HOME_HZ, QGCSConfigInternal::TelemetryRateHome},
+    {KEY_TELEMETRY_FIXEDWING_METRICS_HZ,
+     QGCSConfigInternal::TelemetryRateFixedwingMetrics},
+};
 
 QVariant settingsValue(QSettings *settings, const char *key,
                        const char *legacyKey, const QVariant &defaultValue)
@@ -89,55 +167,70 @@ QVariant settingsValue(QSettings *settings, const char *key,
     }
     return defaultValue;
 }
-thread_local bool g_emittingFirmwareLog = false;
 QtMessageHandler g_previousQtMessageHandler = nullptr;
 bool g_qtLogHandlerInstalled = false;
 
-class FirmwareLogScope final
+/**
+ * @brief 将 warning 及以上级别的业务日志转发为 QGCSConfig::warningLogMessage
+ *
+ * 异步模式下在日志线程上调用。待送达的日志先缓存，每批只投递一次排队调用，
+ * 界面线程在一次调用中依次发射；积压超过上限的日志丢弃，并在下一批末尾
+ * 以一条汇总提示报告丢弃数量。
+ */
+class QtWarningSink final
+    : public spdlog::sinks::base_sink<std::mutex>
+    , public std::enable_shared_from_this<QtWarningSink>
 {
 public:
-    FirmwareLogScope()
-        : m_previous(g_emittingFirmwareLog)
-    {
-        g_emittingFirmwareLog = true;
-    }
+    static constexpr std::size_t MaxPendingWarnings = 256;
 
-    ~FirmwareLogScope()
-    {
-        g_emittingFirmwareLog = m_previous;
-    }
-
-private:
-    bool m_previous;
-};
-
-class QtWarningSink final : public spdlog::sinks::base_sink<std::mutex>
-{
-public:
     explicit QtWarningSink(QGCSConfig *config)
         : m_config(config)
     {}
 
+    uint64_t droppedWarnings() const
+    {
+        return m_droppedTotal.load(std::memory_order_relaxed);
+    }
+
 protected:
     void sink_it_(const spdlog::details::log_msg &message) override
     {
         if (message.level < spdlog::level::warn || !m_config ||
-            g_emittingFirmwareLog) {
+            message.logger_name ==
+                spdlog::string_view_t(FIRMWARE_LOGGER_NAME)) {
+            return;
+        }
+        if (m_pending.size() >= MaxPendingWarnings) {
+            ++m_droppedInBatch;
+            m_droppedTotal.fetch_add(1, std::memory_order_relaxed);
             return;
         }
 
         spdlog::memory_buf_t buffer;
         formatter_->format(message, buffer);
-        const QString text =
-            QString::fromUtf8(buffer.data(), static_cast<qsizetype>(buffer.size()))
-                .trimmed();
-        const int level = static_cast<int>(message.level);
+        m_pending.push_back(PendingWarning{
+            static_cast<int>(message.level),
+            QString::fromUtf8(buffer.data(),
+                              static_cast<qsizetype>(buffer.size()))
+                .trimmed()});
+        if (m_deliveryPending) {
+            return;
+        }
+        m_deliveryPending = true;
+
+        const std::weak_ptr<QtWarningSink> weakSink = weak_from_this();
         const QPointer<QGCSConfig> config = m_config;
         QMetaObject::invokeMethod(
             m_config,
-            [config, level, text]() {
-                if (config) {
-                    emit config->warningLogMessage(level, text);
+            [weakSink, config]() {
+                const auto sink = weakSink.lock();
+                if (!sink || !config) {
+                    return;
+                }
+                for (const PendingWarning &warning : sink->takePending()) {
+                    emit config->warningLogMessage(warning.level,
+                                                   warning.text);
                 }
             },
             Qt::QueuedConnection);
@@ -146,8 +239,285 @@ protected:
     void flush_() override {}
 
 private:
+    struct PendingWarning
+    {
+        int level;
+        QString text;
+    };
+
+    std::vector<PendingWarning> takePending()
+    {
+        std::vector<PendingWarning> batch;
+        std::scoped_lock lock(mutex_);
+        batch.swap(m_pending);
+        m_deliveryPending = false;
+        if (m_droppedInBatch > 0) {
+            batch.push_back(PendingWarning{
+                static_cast<int>(spdlog::level::warn),
+                QStringLiteral("[MiniGCS] 日志过多，已丢弃 %1 条 warning")
+                    .arg(m_droppedInBatch)});
+            m_droppedInBatch = 0;
+        }
+        return batch;
+    }
+
     QPointer<QGCSConfig> m_config;
+    std::vector<PendingWarning> m_pending; ///< 受 base_sink::mutex_ 保护
+    bool m_deliveryPending{false};
+    uint64_t m_droppedInBatch{0};
+    std::atomic<uint64_t> m_droppedTotal{0};
+};
+
+/// init_logging() 创建，供丢弃计数查询
+std::shared_ptr<QtWarningSink> g_warningSink;
+
+std::shared_ptr<spdlog::logger> firmwareLogger()
+{
+    if (auto logger = spdlog::get(FIRMWARE_LOGGER_NAME)) {
+        return logger;
+    }
+    return spdlog::default_logger();
+}
+
+/**
+ * @brief 从 INI 一次性读取全部热路径配置；settings 为空时全部取默认值
+ */
+QGCSConfigSnapshot readSnapshot(QSettings *settings)
+{
+    const auto number = [settings](const char *key, const QVariant &defaultValue) {
+        return settingsValue(settings, key, nullptr, defaultValue);
+    };
+
+    QGCSConfigSnapshot snapshot{};
+    snapshot.stationId = static_cast<uint8_t>(
+        number(KEY_GCS_SYSTEM_ID, static_cast<int>(DEFAULT_GCS_SYSTEM_ID))
+            .toInt());
+    snapshot.stationComponentId = static_cast<uint8_t>(
+        number(KEY_GCS_COMPONENT_ID,
+               static_cast<int>(DEFAULT_GCS_COMPONENT_ID)).toInt());
+    snapshot.timeSyncEnabled =
+        number(KEY_TIME_SYNC_ENABLED, DEFAULT_TIME_SYNC_ENABLED).toBool();
+
+    snapshot.motionStartHorizontalSpeedMS =
+        number(KEY_MOTION_START_HORIZONTAL, DEFAULT_MOTION_START_HORIZONTAL)
+            .toDouble();
+    snapshot.motionStartVerticalSpeedMS =
+        number(KEY_MOTION_START_VERTICAL, DEFAULT_MOTION_START_VERTICAL)
+            .toDouble();
+    snapshot.motionStopHorizontalSpeedMS =
+        number(KEY_MOTION_STOP_HORIZONTAL, DEFAULT_MOTION_STOP_HORIZONTAL)
+            .toDouble();
+    snapshot.motionStopVerticalSpeedMS =
+        number(KEY_MOTION_STOP_VERTICAL, DEFAULT_MOTION_STOP_VERTICAL)
+            .toDouble();
+    snapshot.motionStartSampleCount =
+        number(KEY_MOTION_START_SAMPLES, DEFAULT_MOTION_START_SAMPLES).toInt();
+    snapshot.motionStopSampleCount =
+        number(KEY_MOTION_STOP_SAMPLES, DEFAULT_MOTION_STOP_SAMPLES).toInt();
+
+    snapshot.commandAckTimeoutMs = qBound(
+        1000,
+        settingsValue(settings, KEY_COMMAND_ACK_TIMEOUT_MS,
+                      KEY_COMMAND_ACK_TIMEOUT_MS_LEGACY,
+                      DEFAULT_COMMAND_ACK_TIMEOUT_MS).toInt(),
+        60000);
+
+    snapshot.telemetryPositionHz =
+        number(KEY_TELEMETRY_POSITION_HZ, DEFAULT_TELEMETRY_POSITION_HZ)
+            .toDouble();
+    snapshot.telemetryPositionVelocityNedHz =
+        number(KEY_TELEMETRY_POSITION_VELOCITY_NED_HZ,
+               DEFAULT_TELEMETRY_POSITION_VELOCITY_NED_HZ).toDouble();
+    snapshot.telemetryGpsInfoHz =
+        number(KEY_TELEMETRY_GPS_INFO_HZ, DEFAULT_TELEMETRY_GPS_INFO_HZ)
+            .toDouble();
+    snapshot.telemetryBatteryHz =
+        number(KEY_TELEMETRY_BATTERY_HZ, DEFAULT_TELEMETRY_BATTERY_HZ)
+            .toDouble();
+    snapshot.telemetryRawGpsHz =
+        number(KEY_TELEMETRY_RAW_GPS_HZ, DEFAULT_TELEMETRY_RAW_GPS_HZ)
+            .toDouble();
+    snapshot.telemetryAttitudeHz =
+        number(KEY_TELEMETRY_ATTITUDE_HZ, DEFAULT_TELEMETRY_ATTITUDE_HZ)
+            .toDouble();
+    snapshot.telemetryLandedStateHz =
+        number(KEY_TELEMETRY_LANDED_STATE_HZ, DEFAULT_TELEMETRY_LANDED_STATE_HZ)
+            .toDouble();
+    snapshot.telemetryHealthHz =
+        number(KEY_TELEMETRY_HEALTH_HZ, DEFAULT_TELEMETRY_HEALTH_HZ)
+            .toDouble();
+    snapshot.telemetryHomeHz =
+        number(KEY_TELEMETRY_HOME_HZ, DEFAULT_TELEMETRY_HOME_HZ).toDouble();
+    snapshot.telemetryFixedwingMetricsHz =
+        number(KEY_TELEMETRY_FIXEDWING_METRICS_HZ,
+               DEFAULT_TELEMETRY_FIXEDWING_METRICS_HZ).toDouble();
+    snapshot.telemetryFlushIntervalMs = qBound(
+        0,
+        number(KEY_TELEMETRY_FLUSH_INTERVAL_MS,
+               DEFAULT_TELEMETRY_FLUSH_INTERVAL_MS).toInt(),
+        1000);
+    snapshot.telemetryWorkerThreads = qBound(
+        0,
+        number(KEY_TELEMETRY_WORKER_THREADS, DEFAULT_TELEMETRY_WORKER_THREADS)
+            .toInt(),
+        16);
+    snapshot.telemetryRateUpdateIntervalMs = qBound(
+        0,
+        number(KEY_TELEMETRY_RATE_UPDATE_INTERVAL_MS,
+               DEFAULT_TELEMETRY_RATE_UPDATE_INTERVAL_MS).toInt(),
+        1000);
+    snapshot.telemetryDemandDriven =
+        number(KEY_TELEMETRY_DEMAND_DRIVEN, DEFAULT_TELEMETRY_DEMAND_DRIVEN)
+            .toBool();
+    snapshot.telemetryLinkBudgetUtilization = qBound(
+        0.0,
+        number(KEY_TELEMETRY_LINK_BUDGET_UTILIZATION,
+               DEFAULT_TELEMETRY_LINK_BUDGET_UTILIZATION).toDouble(),
+        1.0);
+    const auto profileScale = [&number](const char *key, double defaultScale) {
+        return qBound(0.01, number(key, defaultScale).toDouble(), 10.0);
+    };
+    snapshot.telemetryProfileScale[0] = profileScale(
+        KEY_TELEMETRY_PROFILE_FOCUSED_SCALE,
+        DEFAULT_TELEMETRY_PROFILE_FOCUSED_SCALE);
+    snapshot.telemetryProfileScale[1] = profileScale(
+        KEY_TELEMETRY_PROFILE_BACKGROUND_SCALE,
+        DEFAULT_TELEMETRY_PROFILE_BACKGROUND_SCALE);
+    snapshot.telemetryProfileScale[2] = profileScale(
+        KEY_TELEMETRY_PROFILE_IDLE_ON_GROUND_SCALE,
+        DEFAULT_TELEMETRY_PROFILE_IDLE_ON_GROUND_SCALE);
+    return snapshot;
+}
+
+/**
+ * @brief 按 `Trace/` 组开启或停止内部跟踪；停止与切换文件时写出已记录的事件
+ */
+void applyTraceSettings(QSettings *settings)
+{
+    const QString file =
+        settingsValue(settings, KEY_TRACE_FILE, nullptr,
+                      QString::fromLatin1(DEFAULT_TRACE_FILE))
+            .toString()
+            .trimmed();
+    if (file.isEmpty()) {
+        QGCSTrace::stop();
+        return;
+    }
+    const int maxEvents = qBound(
+        1000,
+        settingsValue(settings, KEY_TRACE_MAX_EVENTS, nullptr,
+                      DEFAULT_TRACE_MAX_EVENTS).toInt(),
+        10000000);
+    /// 相对路径与日志目录一样相对工作目录
+    const QString path = QFileInfo(file).absoluteFilePath();
+    QGCSTrace::start(std::filesystem::path(path.toStdU16String()),
+                     static_cast<std::size_t>(maxEvents));
+    spdlog::info(SYS_FMT_STR, "trace enabled", path.toStdString());
+}
+
+/**
+ * @brief 按 `Journal/` 组打开或关闭二进制事件日志；路径与容量不变时保持原映射
+ */
+void applyJournalSettings(QSettings *settings)
+{
+    const QString file =
+        settingsValue(settings, KEY_JOURNAL_FILE, nullptr,
+                      QString::fromLatin1(DEFAULT_JOURNAL_FILE))
+            .toString()
+            .trimmed();
+    if (file.isEmpty()) {
+        QGCSJournal::stop();
+        return;
+    }
+    const int capacity = qBound(
+        1024,
+        settingsValue(settings, KEY_JOURNAL_CAPACITY, nullptr,
+                      DEFAULT_JOURNAL_CAPACITY).toInt(),
+        16777216);
+    QGCSJournal::start(QFileInfo(file).absoluteFilePath(),
+                       static_cast<uint32_t>(capacity));
+}
+
+QVariantMap settingsValues(QSettings *settings)
+{
+    QVariantMap values;
+    for (const QString &key : settings->allKeys()) {
+        values.insert(key, settings->value(key));
+    }
+    return values;
+}
+
+/**
+ * @brief 比较两次读取的全部键值，返回新增、删除或值变化的键（按键名排序）
+ */
+QStringList changedSettingsKeys(const QVariantMap &before,
+                                const QVariantMap &after)
+{
+    QStringList keys;
+    for (auto it = after.constBegin(); it != after.constEnd(); ++it) {
+        const auto previous = before.constFind(it.key());
+        if (previous == before.constEnd() || previous.value() != it.value()) {
+            keys.append(it.key());
+        }
+    }
+    for (auto it = before.constBegin(); it != before.constEnd(); ++it) {
+        if (!after.contains(it.key())) {
+            keys.append(it.key());
+        }
+    }
+    keys.sort();
+    return keys;
+}
+
+struct SnapshotState
+{
+    std::atomic<const QGCSConfigSnapshot *> current{nullptr};
+    std::mutex mutex;
+    /// 发布过的快照保留到进程结束，读者无需引用计数；内容未变时不重新发布
+    std::vector<std::unique_ptr<const QGCSConfigSnapshot>> published;
 };
+
+SnapshotState &snapshotState()
+{
+    static SnapshotState state;
+    return state;
+}
+
+const QGCSConfigSnapshot *publishSnapshot(QSettings *settings)
+{
+    const QGCSConfigSnapshot snapshot = readSnapshot(settings);
+
+    SnapshotState &state = snapshotState();
+    std::scoped_lock lock(state.mutex);
+    const QGCSConfigSnapshot *current =
+        state.current.load(std::memory_order_acquire);
+    if (current && *current == snapshot) {
+        return current;
+    }
+    for (const auto &retained : state.published) {
+        if (*retained == snapshot) {
+            state.current.store(retained.get(), std::memory_order_release);
+            return retained.get();
+        }
+    }
+    state.published.push_back(std::make_unique<const QGCSConfigSnapshot>(snapshot));
+    const QGCSConfigSnapshot *published = state.published.back().get();
+    state.current.store(published, std::memory_order_release);
+    return published;
+}
+
+void resetSnapshot()
+{
+    snapshotState().current.store(nullptr, std::memory_order_release);
+}
+
+const QGCSConfigSnapshot &currentSnapshot()
+{
+    const QGCSConfigSnapshot *snapshot =
+        snapshotState().current.load(std::memory_order_acquire);
+    /// 尚未 init() 时按默认值发布，不触碰任何 QSettings
+    return snapshot ? *snapshot : *publishSnapshot(nullptr);
+}
 } // namespace
 
 // 将 QString（名称）映射到 spdlog 的 level_enum
@@ -171,7 +541,10 @@ static spdlog::level::level_enum levelFromString(const QString &levelStr) {
     return spdlog::level::debug;
 }
 
-QGCSConfig::QGCSConfig(QObject *parent) : QObject(parent) {}
+QGCSConfig::QGCSConfig(QObject *parent) : QObject(parent) {
+    qRegisterMetaType<QJournalEvent>("QJournalEvent");
+    qRegisterMetaType<QList<QJournalEvent>>("QList<QJournalEvent>");
+}
 
 QGCSConfig::~QGCSConfig() {
     spdlog::warn(SYS_FMT_STR,"系统正在清理资源","即将退出……");
@@ -195,6 +568,7 @@ void QGCSConfig::setInstance(QGCSConfig *p) {
         delete m_pSInsatance;
     }
     m_pSInsatance = p;
+    publishSnapshot(p ? p->m_settings : nullptr);
 }
 
 void QGCSConfig::init_logging() {
@@ -210,9 +584,24 @@ void QGCSConfig::init_logging() {
         auto warning_sink = std::make_shared<QtWarningSink>(this);
 
         QString configuredLevel = DEFAULT_LOG_LEVEL;
+        bool async = DEFAULT_LOG_ASYNC;
+        int queueSize = DEFAULT_LOG_QUEUE_SIZE;
+        QString overflowPolicy = DEFAULT_LOG_OVERFLOW_POLICY;
         if (m_settings) {
             configuredLevel =
                 m_settings->value(KEY_LOG_LEVEL, DEFAULT_LOG_LEVEL).toString();
+            async = m_settings->value(KEY_LOG_ASYNC, DEFAULT_LOG_ASYNC).toBool();
+            queueSize = qBound(
+                256,
+                m_settings->value(KEY_LOG_QUEUE_SIZE, DEFAULT_LOG_QUEUE_SIZE)
+                    .toInt(),
+                1048576);
+            overflowPolicy = m_settings
+                                 ->value(KEY_LOG_OVERFLOW_POLICY,
+                                         DEFAULT_LOG_OVERFLOW_POLICY)
+                                 .toString()
+                                 .trimmed()
+                                 .toLower();
         }
         spdlog::level::level_enum lvl = levelFromString(configuredLevel);
 
@@ -223,16 +612,37 @@ void QGCSConfig::init_logging() {
         sinks.push_back(file_sink);
         sinks.push_back(warning_sink);
 
-        auto logger =
-            std::make_shared<spdlog::logger>("core", sinks.begin(), sinks.end());
+        /// 异步模式：调用线程只格式化消息参数并入队，排版、sink 锁与文件 I/O
+        /// 在单独的日志线程完成；队列有界，满时按策略覆盖最旧条目或阻塞
+        std::shared_ptr<spdlog::logger> logger;
+        if (async) {
+            spdlog::init_thread_pool(static_cast<std::size_t>(queueSize), 1);
+            logger = std::make_shared<spdlog::async_logger>(
+                "core", sinks.begin(), sinks.end(), spdlog::thread_pool(),
+                overflowPolicy == QLatin1String("block")
+                    ? spdlog::async_overflow_policy::block
+                    : spdlog::async_overflow_policy::overrun_oldest);
+        } else {
+            logger = std::make_shared<spdlog::logger>(
+                "core", sinks.begin(), sinks.end());
+        }
         spdlog::set_default_logger(logger);
+        g_warningSink = warning_sink;
 
         spdlog::set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%t] %v");
         logger->set_level(
             lvl < spdlog::level::warn ? lvl : spdlog::level::warn);
 
+        spdlog::drop(FIRMWARE_LOGGER_NAME);
+        spdlog::register_logger(logger->clone(FIRMWARE_LOGGER_NAME));
+
         spdlog::warn(SYS_FMT_STR, "系统启动 日志级别",
                      configuredLevel.toStdString());
+        if (async) {
+            spdlog::info(SYS_FMT_STR, "异步日志",
+                         fmt::format("queue={} policy={}", queueSize,
+                                     overflowPolicy.toStdString()));
+        }
     } catch (const spdlog::spdlog_ex &error) {
         qWarning() << "日志系统初始化失败:" << error.what();
     }
@@ -240,35 +650,43 @@ void QGCSConfig::init_logging() {
 
 void QGCSConfig::qtLogHandler(QtMsgType type, const QMessageLogContext &ctx,
                               const QString &msg) {
-    std::string logMsg(msg.toUtf8().constData());
-    const char *pFileName = nullptr;
-    if (nullptr != ctx.file) {
-        pFileName = strrchr(ctx.file, '/');
-        if (nullptr == pFileName) {
-            pFileName = strrchr(ctx.file, '\\');
-        }
-    }
-
-    // 拼接上下文信息
-    std::string ctxInfo = fmt::format(
-        "[{}:{} {}] {}", nullptr != pFileName ? pFileName+1 : "", ctx.line,
-        ctx.function ? ctx.function : "", logMsg);
-
+    spdlog::level::level_enum level = spdlog::level::err;
     switch (type) {
     case QtDebugMsg:
-        spdlog::debug(ctxInfo);
+        level = spdlog::level::debug;
         break;
     case QtInfoMsg:
-        spdlog::info(ctxInfo);
+        level = spdlog::level::info;
         break;
     case QtWarningMsg:
-        spdlog::warn(ctxInfo);
+        level = spdlog::level::warn;
         break;
     case QtCriticalMsg:
     case QtFatalMsg:
-        spdlog::error(ctxInfo);
+        level = spdlog::level::err;
         break;
     }
+    /// 先按级别过滤，被过滤的消息不做任何转换与格式化
+    spdlog::logger *logger = spdlog::default_logger_raw();
+    if (!logger || !logger->should_log(level)) {
+        return;
+    }
+
+    const char *pFileName = nullptr;
+    if (nullptr != ctx.file) {
+        pFileName = strrchr(ctx.file, '/');
+        if (nullptr == pFileName) {
+            pFileName = strrchr(ctx.file, '\\');
+        }
+    }
+
+    // 拼接上下文信息
+    const QByteArray text = msg.toUtf8();
+    logger->log(level, "[{}:{} {}] {}",
+                nullptr != pFileName ? pFileName + 1 : "", ctx.line,
+                ctx.function ? ctx.function : "",
+                std::string_view(text.constData(),
+                                 static_cast<std::size_t>(text.size())));
 }
 
 void QGCSConfig::init() {
@@ -299,6 +717,8 @@ void QGCSConfig::init() {
         qWarning() << "配置文件读写异常:" << m_configFilePath
                    << "status=" << m_settings->status();
     }
+    publishSnapshot(m_settings);
+    watchConfigFile();
 
     // 默认值与用户配置加载完成后再初始化日志。
     init_logging();
@@ -307,9 +727,13 @@ void QGCSConfig::init() {
             qInstallMessageHandler(&QGCSConfig::qtLogHandler);
         g_qtLogHandlerInstalled = true;
     }
+    applyTraceSettings(m_settings);
+    applyJournalSettings(m_settings);
 }
 
 void QGCSConfig::release() {
+    QGCSTrace::stop();
+    QGCSJournal::stop();
     if (g_qtLogHandlerInstalled) {
         qInstallMessageHandler(g_previousQtMessageHandler);
         g_previousQtMessageHandler = nullptr;
@@ -317,6 +741,16 @@ void QGCSConfig::release() {
     }
     delete m_pSInsatance;
     m_pSInsatance = nullptr;
+    resetSnapshot();
+}
+
+quint64 QGCSConfig::droppedLogMessages() const {
+    const auto pool = spdlog::thread_pool();
+    return pool ? static_cast<quint64>(pool->overrun_counter()) : 0;
+}
+
+quint64 QGCSConfig::droppedWarningMessages() const {
+    return g_warningSink ? g_warningSink->droppedWarnings() : 0;
 }
 
 QString QGCSConfig::logLevel() const {
@@ -326,24 +760,11 @@ QString QGCSConfig::logLevel() const {
 }
 
 uint8_t QGCSConfig::stationId() const {
-    if (!m_settings) {
-        return DEFAULT_GCS_SYSTEM_ID;
-    }
-    return static_cast<uint8_t>(
-        m_settings
-            ->value(KEY_GCS_SYSTEM_ID, static_cast<int>(DEFAULT_GCS_SYSTEM_ID))
-            .toInt());
+    return currentSnapshot().stationId;
 }
 
 uint8_t QGCSConfig::stationComponentId() const {
-    if (!m_settings) {
-        return DEFAULT_GCS_COMPONENT_ID;
-    }
-    return static_cast<uint8_t>(
-        m_settings
-            ->value(KEY_GCS_COMPONENT_ID,
-                    static_cast<int>(DEFAULT_GCS_COMPONENT_ID))
-            .toInt());
+    return currentSnapshot().stationComponentId;
 }
 
 namespace {
@@ -430,75 +851,103 @@ QString QGCSConfig::typeText(
 }
 
 bool QGCSConfig::timeSyncEnabled() const {
-    if (!m_settings) {
-        return DEFAULT_TIME_SYNC_ENABLED;
-    }
-    return m_settings->value(KEY_TIME_SYNC_ENABLED, DEFAULT_TIME_SYNC_ENABLED).toBool();
+    return currentSnapshot().timeSyncEnabled;
 }
 
 double QGCSConfig::motionStartHorizontalSpeedMS() const
 {
-    return m_settings
-        ? m_settings->value(KEY_MOTION_START_HORIZONTAL,
-                            DEFAULT_MOTION_START_HORIZONTAL).toDouble()
-        : DEFAULT_MOTION_START_HORIZONTAL;
+    return currentSnapshot().motionStartHorizontalSpeedMS;
 }
 
 double QGCSConfig::motionStartVerticalSpeedMS() const
 {
-    return m_settings
-        ? m_settings->value(KEY_MOTION_START_VERTICAL,
-                            DEFAULT_MOTION_START_VERTICAL).toDouble()
-        : DEFAULT_MOTION_START_VERTICAL;
+    return currentSnapshot().motionStartVerticalSpeedMS;
 }
 
 double QGCSConfig::motionStopHorizontalSpeedMS() const
 {
-    return m_settings
-        ? m_settings->value(KEY_MOTION_STOP_HORIZONTAL,
-                            DEFAULT_MOTION_STOP_HORIZONTAL).toDouble()
-        : DEFAULT_MOTION_STOP_HORIZONTAL;
+    return currentSnapshot().motionStopHorizontalSpeedMS;
 }
 
 double QGCSConfig::motionStopVerticalSpeedMS() const
 {
-    return m_settings
-        ? m_settings->value(KEY_MOTION_STOP_VERTICAL,
-                            DEFAULT_MOTION_STOP_VERTICAL).toDouble()
-        : DEFAULT_MOTION_STOP_VERTICAL;
+    return currentSnapshot().motionStopVerticalSpeedMS;
 }
 
 int QGCSConfig::motionStartSampleCount() const
 {
-    return m_settings
-        ? m_settings->value(KEY_MOTION_START_SAMPLES,
-                            DEFAULT_MOTION_START_SAMPLES).toInt()
-        : DEFAULT_MOTION_START_SAMPLES;
+    return currentSnapshot().motionStartSampleCount;
 }
 
 int QGCSConfig::motionStopSampleCount() const
 {
-    return m_settings
-        ? m_settings->value(KEY_MOTION_STOP_SAMPLES,
-                            DEFAULT_MOTION_STOP_SAMPLES).toInt()
-        : DEFAULT_MOTION_STOP_SAMPLES;
+    return currentSnapshot().motionStopSampleCount;
 }
 
 void QGCSConfig::setTimeSyncEnabled(bool enabled) {
     if (m_settings) {
         m_settings->setValue(KEY_TIME_SYNC_ENABLED, enabled);
+        publishSnapshot(m_settings);
     }
 }
 
 void QGCSConfig::save() {
     if (m_settings) {
         m_settings->sync();
+        publishSnapshot(m_settings);
     }
 }
 
 void QGCSConfig::reload() {
+    QStringList changedKeys;
     if (m_settings) {
+        const QVariantMap before = settingsValues(m_settings);
         m_settings->sync();
+        changedKeys = changedSettingsKeys(before, settingsValues(m_settings));
+        publishSnapshot(m_settings);
+    }
+    QMavsdkTextCatalog::reload();
+    if (std::any_of(changedKeys.cbegin(), changedKeys.cend(),
+                    [](const QString &key) {
+                        return key.startsWith(QLatin1String(KEY_TRACE_GROUP));
+                    })) {
+        applyTraceSettings(m_settings);
+    }
+    if (std::any_of(changedKeys.cbegin(), changedKeys.cend(),
+                    [](const QString &key) {
+                        return key.startsWith(QLatin1String(KEY_JOURNAL_GROUP));
+                    })) {
+        applyJournalSettings(m_settings);
+    }
+    if (!changedKeys.isEmpty()) {
+        spdlog::info(SYS_FMT_STR, "配置文件已变化",
+                     changedKeys.join(QLatin1Char(',')).toStdString());
+        emit settingsChanged(changedKeys);
+    }
+}
+
+void QGCSConfig::watchConfigFile() {
+    if (m_configFilePath.isEmpty()) {
+        return;
+    }
+
+    auto *watcher = new QFileSystemWatcher(this);
+    auto *debounce = new QTimer(this);
+    debounce->setSingleShot(true);
+    debounce->setInterval(CONFIG_RELOAD_DEBOUNCE_MS);
+    connect(watcher, &QFileSystemWatcher::fileChanged, debounce,
+            qOverload<>(&QTimer::start));
+
+    const QString path = m_configFilePath;
+    connect(debounce, &QTimer::timeout, this, [this, watcher, path]() {
+        /// 以替换方式保存的编辑器会使原路径脱离监视，重新加入
+        if (!watcher->files().contains(path) && QFileInfo::exists(path)) {
+            watcher->addPath(path);
+        }
+        reload();
+    });
+    if (QFileInfo::exists(path)) {
+        watcher->addPath(path);
     }
 }
 
@@ -521,6 +970,16 @@ void QGCSConfig::initializeDefaults() {
     if (!m_settings->contains(KEY_LOG_LEVEL)) {
         m_settings->setValue(KEY_LOG_LEVEL, DEFAULT_LOG_LEVEL);
     }
+    if (!m_settings->contains(KEY_LOG_ASYNC)) {
+        m_settings->setValue(KEY_LOG_ASYNC, DEFAULT_LOG_ASYNC);
+    }
+    if (!m_settings->contains(KEY_LOG_QUEUE_SIZE)) {
+        m_settings->setValue(KEY_LOG_QUEUE_SIZE, DEFAULT_LOG_QUEUE_SIZE);
+    }
+    if (!m_settings->contains(KEY_LOG_OVERFLOW_POLICY)) {
+        m_settings->setValue(KEY_LOG_OVERFLOW_POLICY,
+                             DEFAULT_LOG_OVERFLOW_POLICY);
+    }
     if (!m_settings->contains(QLatin1String(KEY_MESSAGE_EXTENSION)) &&
         !m_settings->contains(QLatin1String(KEY_MESSAGE_EXTENSION_LEGACY))) {
         m_settings->setValue(KEY_MESSAGE_EXTENSION, DEFAULT_MESSAGE_EXTENSION);
@@ -601,6 +1060,51 @@ void QGCSConfig::initializeDefaults() {
         m_settings->setValue(KEY_TELEMETRY_FIXEDWING_METRICS_HZ,
                              DEFAULT_TELEMETRY_FIXEDWING_METRICS_HZ);
     }
+    if (!m_settings->contains(KEY_TELEMETRY_FLUSH_INTERVAL_MS)) {
+        m_settings->setValue(KEY_TELEMETRY_FLUSH_INTERVAL_MS,
+                             DEFAULT_TELEMETRY_FLUSH_INTERVAL_MS);
+    }
+    if (!m_settings->contains(KEY_TELEMETRY_WORKER_THREADS)) {
+        m_settings->setValue(KEY_TELEMETRY_WORKER_THREADS,
+                             DEFAULT_TELEMETRY_WORKER_THREADS);
+    }
+    if (!m_settings->contains(KEY_TELEMETRY_RATE_UPDATE_INTERVAL_MS)) {
+        m_settings->setValue(KEY_TELEMETRY_RATE_UPDATE_INTERVAL_MS,
+                             DEFAULT_TELEMETRY_RATE_UPDATE_INTERVAL_MS);
+    }
+    if (!m_settings->contains(KEY_TELEMETRY_DEMAND_DRIVEN)) {
+        m_settings->setValue(KEY_TELEMETRY_DEMAND_DRIVEN,
+                             DEFAULT_TELEMETRY_DEMAND_DRIVEN);
+    }
+    if (!m_settings->contains(KEY_TELEMETRY_LINK_BUDGET_UTILIZATION)) {
+        m_settings->setValue(KEY_TELEMETRY_LINK_BUDGET_UTILIZATION,
+                             DEFAULT_TELEMETRY_LINK_BUDGET_UTILIZATION);
+    }
+    if (!m_settings->contains(KEY_TELEMETRY_PROFILE_FOCUSED_SCALE)) {
+        m_settings->setValue(KEY_TELEMETRY_PROFILE_FOCUSED_SCALE,
+                             DEFAULT_TELEMETRY_PROFILE_FOCUSED_SCALE);
+    }
+    if (!m_settings->contains(KEY_TELEMETRY_PROFILE_BACKGROUND_SCALE)) {
+        m_settings->setValue(KEY_TELEMETRY_PROFILE_BACKGROUND_SCALE,
+                             DEFAULT_TELEMETRY_PROFILE_BACKGROUND_SCALE);
+    }
+    if (!m_settings->contains(KEY_TELEMETRY_PROFILE_IDLE_ON_GROUND_SCALE)) {
+        m_settings->setValue(KEY_TELEMETRY_PROFILE_IDLE_ON_GROUND_SCALE,
+                             DEFAULT_TELEMETRY_PROFILE_IDLE_ON_GROUND_SCALE);
+    }
+
+    if (!m_settings->contains(KEY_TRACE_FILE)) {
+        m_settings->setValue(KEY_TRACE_FILE, DEFAULT_TRACE_FILE);
+    }
+    if (!m_settings->contains(KEY_TRACE_MAX_EVENTS)) {
+        m_settings->setValue(KEY_TRACE_MAX_EVENTS, DEFAULT_TRACE_MAX_EVENTS);
+    }
+    if (!m_settings->contains(KEY_JOURNAL_FILE)) {
+        m_settings->setValue(KEY_JOURNAL_FILE, DEFAULT_JOURNAL_FILE);
+    }
+    if (!m_settings->contains(KEY_JOURNAL_CAPACITY)) {
+        m_settings->setValue(KEY_JOURNAL_CAPACITY, DEFAULT_JOURNAL_CAPACITY);
+    }
 
     // 立即保存默认值
     m_settings->sync();
@@ -628,29 +1132,29 @@ struct QGCSConfigPrivateAccess {
                 static_cast<quint32>(vehicleId), formatted);
         }
 
-        const FirmwareLogScope firmwareLogScope;
+        const std::shared_ptr<spdlog::logger> logger = firmwareLogger();
         switch (severity) {
         case QGCSConfig::LogSeverityEmergency:
         case QGCSConfig::LogSeverityAlert:
         case QGCSConfig::LogSeverityCritical:
-            spdlog::critical(PLAT_FMT_STR, vehicleId, "text",
+            logger->critical(PLAT_FMT_STR, vehicleId, "text",
                              text.toUtf8().data());
             break;
         case QGCSConfig::LogSeverityError:
-            spdlog::error(PLAT_FMT_STR, vehicleId, "text",
+            logger->error(PLAT_FMT_STR, vehicleId, "text",
                           text.toUtf8().data());
             break;
         case QGCSConfig::LogSeverityWarning:
-            spdlog::warn(PLAT_FMT_STR, vehicleId, "text",
+            logger->warn(PLAT_FMT_STR, vehicleId, "text",
                          text.toUtf8().data());
             break;
         case QGCSConfig::LogSeverityNotice:
         case QGCSConfig::LogSeverityInfo:
-            spdlog::info(PLAT_FMT_STR, vehicleId, "text",
+            logger->info(PLAT_FMT_STR, vehicleId, "text",
                          text.toUtf8().data());
             break;
         case QGCSConfig::LogSeverityDebug:
-            spdlog::debug(PLAT_FMT_STR, vehicleId, "text",
+            logger->debug(PLAT_FMT_STR, vehicleId, "text",
                           text.toUtf8().data());
             break;
         }
@@ -667,26 +1171,6 @@ struct QGCSConfigPrivateAccess {
             configured, self ? self->m_configFilePath : QString(),
             QString::fromLatin1(DEFAULT_MESSAGE_EXTENSION));
     }
-
-    static int commandAckTimeoutMs()
-    {
-        QGCSConfig *self = config();
-        const int configured = settingsValue(
-            self ? self->m_settings : nullptr, KEY_COMMAND_ACK_TIMEOUT_MS,
-            KEY_COMMAND_ACK_TIMEOUT_MS_LEGACY,
-            DEFAULT_COMMAND_ACK_TIMEOUT_MS).toInt();
-        return qBound(1000, configured, 60000);
-    }
-
-    static double telemetryHz(const char *key, double defaultHz)
-    {
-        QGCSConfig *self = config();
-        if (!self || !self->m_settings) {
-            return defaultHz;
-        }
-        return self->m_settings->value(QLatin1String(key), defaultHz)
-            .toDouble();
-    }
 };
 
 namespace QGCSConfigInternal {
@@ -701,71 +1185,145 @@ QString messageExtensionFile()
     return QGCSConfigPrivateAccess::messageExtensionFile();
 }
 
+const QGCSConfigSnapshot &snapshot()
+{
+    return currentSnapshot();
+}
+
 int commandAckTimeoutMs()
 {
-    return QGCSConfigPrivateAccess::commandAckTimeoutMs();
+    return currentSnapshot().commandAckTimeoutMs;
 }
 
 double telemetryPositionHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_POSITION_HZ, DEFAULT_TELEMETRY_POSITION_HZ);
+    return currentSnapshot().telemetryPositionHz;
 }
 
 double telemetryPositionVelocityNedHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_POSITION_VELOCITY_NED_HZ,
-        DEFAULT_TELEMETRY_POSITION_VELOCITY_NED_HZ);
+    return currentSnapshot().telemetryPositionVelocityNedHz;
 }
 
 double telemetryGpsInfoHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_GPS_INFO_HZ, DEFAULT_TELEMETRY_GPS_INFO_HZ);
+    return currentSnapshot().telemetryGpsInfoHz;
 }
 
 double telemetryBatteryHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_BATTERY_HZ, DEFAULT_TELEMETRY_BATTERY_HZ);
+    return currentSnapshot().telemetryBatteryHz;
 }
 
 double telemetryRawGpsHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_RAW_GPS_HZ, DEFAULT_TELEMETRY_RAW_GPS_HZ);
+    return currentSnapshot().telemetryRawGpsHz;
 }
 
 double telemetryAttitudeHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_ATTITUDE_HZ, DEFAULT_TELEMETRY_ATTITUDE_HZ);
+    return currentSnapshot().telemetryAttitudeHz;
 }
 
 double telemetryLandedStateHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_LANDED_STATE_HZ, DEFAULT_TELEMETRY_LANDED_STATE_HZ);
+    return currentSnapshot().telemetryLandedStateHz;
 }
 
 double telemetryHealthHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_HEALTH_HZ, DEFAULT_TELEMETRY_HEALTH_HZ);
+    return currentSnapshot().telemetryHealthHz;
 }
 
 double telemetryHomeHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_HOME_HZ, DEFAULT_TELEMETRY_HOME_HZ);
+    return currentSnapshot().telemetryHomeHz;
 }
 
 double telemetryFixedwingMetricsHz()
 {
-    return QGCSConfigPrivateAccess::telemetryHz(
-        KEY_TELEMETRY_FIXEDWING_METRICS_HZ,
-        DEFAULT_TELEMETRY_FIXEDWING_METRICS_HZ);
+    return currentSnapshot().telemetryFixedwingMetricsHz;
+}
+
+int telemetryFlushIntervalMs()
+{
+    return currentSnapshot().telemetryFlushIntervalMs;
+}
+
+int telemetryWorkerThreads()
+{
+    return currentSnapshot().telemetryWorkerThreads;
+}
+
+int telemetryRateUpdateIntervalMs()
+{
+    return currentSnapshot().telemetryRateUpdateIntervalMs;
+}
+
+bool telemetryDemandDriven()
+{
+    return currentSnapshot().telemetryDemandDriven;
+}
+
+double telemetryRateHz(uint32_t rate)
+{
+    const QGCSConfigSnapshot &snapshot = currentSnapshot();
+    switch (rate) {
+    case TelemetryRatePosition:
+        return snapshot.telemetryPositionHz;
+    case TelemetryRatePositionVelocityNed:
+        return snapshot.telemetryPositionVelocityNedHz;
+    case TelemetryRateGpsInfo:
+        return snapshot.telemetryGpsInfoHz;
+    case TelemetryRateBattery:
+        return snapshot.telemetryBatteryHz;
+    case TelemetryRateRawGps:
+        return snapshot.telemetryRawGpsHz;
+    case TelemetryRateAttitude:
+        return snapshot.telemetryAttitudeHz;
+    case TelemetryRateLandedState:
+        return snapshot.telemetryLandedStateHz;
+    case TelemetryRateHealth:
+        return snapshot.telemetryHealthHz;
+    case TelemetryRateHome:
+        return snapshot.telemetryHomeHz;
+    case TelemetryRateFixedwingMetrics:
+        return snapshot.telemetryFixedwingMetricsHz;
+    default:
+        return 0.0;
+    }
+}
+
+double telemetryLinkBudgetUtilization()
+{
+    return currentSnapshot().telemetryLinkBudgetUtilization;
+}
+
+double telemetryProfileScale(int profile)
+{
+    const QGCSConfigSnapshot &snapshot = currentSnapshot();
+    if (profile < 0 ||
+        profile >= static_cast<int>(snapshot.telemetryProfileScale.size())) {
+        return 1.0;
+    }
+    return snapshot.telemetryProfileScale[static_cast<std::size_t>(profile)];
+}
+
+uint32_t telemetryRatesForKeys(const QStringList &keys)
+{
+    /// 档位缩放变化影响全部频率
+    for (const QString &key : keys) {
+        if (key.startsWith(QLatin1String(KEY_TELEMETRY_PROFILE_GROUP))) {
+            return TelemetryRateAll;
+        }
+    }
+    uint32_t rates = 0;
+    for (const TelemetryRateKey &entry : TELEMETRY_RATE_KEYS) {
+        if (keys.contains(QLatin1String(entry.key))) {
+            rates |= entry.rate;
+        }
+    }
+    return rates;
 }
 
 } // namespace QGCSConfigInternal
@@ -31,6 +31,7 @@ void QGroundControlStation::Init()
     d_ptr->initializeMavsdk();
     d_ptr->setupConnectionErrorHandling(this);
     d_ptr->setupNewSystemDiscoveryCallback(this);
+    d_ptr->setupTelemetryRatePropagation(this);
 }
 
 void QGroundControlStation::ClearAllLinks()
@@ -45,7 +46,7 @@ bool QGroundControlStation::feedRawData(const char *data, int length)
     if (!d_ptr || !d_ptr->mavsdk() || !data || length <= 0) {
         return false;
     }
-    d_ptr->processReceivedRawData(QByteArray(data, length));
+    d_ptr->processReceivedRawData(data, length);
     return true;
 }
 
@@ -99,6 +100,21 @@ QPlat *QGroundControlStation::getOrCreatePlat(uint8_t uId, bool bIsAutopilot)
                         d_ptr->refreshConnectedSystem(this, uId);
                     }
                 });
+        /// 飞机上下线或切换档位后重新分配链路带宽预算
+        const auto rebalance = [this]() {
+            if (d_ptr) {
+                d_ptr->scheduleTelemetryBudget(this);
+            }
+        };
+        connect(pPlat, &QPlat::connectionStatusChanged, this, rebalance);
+        if (auto *autopilot = qobject_cast<QAutopilot *>(pPlat)) {
+            connect(autopilot, &QAutopilot::telemetryProfileChanged, this,
+                    [this, uId]() {
+                        if (d_ptr) {
+                            d_ptr->scheduleTelemetryProfile(this, uId);
+                        }
+                    });
+        }
         emit platsChanged();
     }
 
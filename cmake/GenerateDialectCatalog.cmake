@@ -0,0 +1,289 @@
+# 把默认方言 XML 的 MAV_CMD 表与 <messages> 字段生成为编译期目录头文件
+#
+# 用法：cmake -DINPUT=<ardupilotmega.xml> -DOUTPUT=<header> -P GenerateDialectCatalog.cmake
+#
+# 与 XmlToMavSDK::loadXml 的解析规则一致：只读取本文件（不展开 <include>），
+# 同名命令以后出现者为准；命令按名称升序输出。INPUT 为空时生成空目录，
+# 运行时回退为解析 XML 文件。同时写入源文件的 SHA-256，运行时据此确认
+# 配置的 XML 与生成目录时所用的文件一致。
+#
+# 文本按字符串处理而不是 CMake 列表，描述中的 ';'、'[' 不会被拆分。
+
+cmake_minimum_required(VERSION 3.16)
+
+if(NOT OUTPUT)
+    message(FATAL_ERROR "GenerateDialectCatalog: OUTPUT is required")
+endif()
+
+# 取开始标签中的属性值；found 为属性是否存在
+function(xml_attribute tag attribute outVar foundVar)
+    if(tag MATCHES "[ \t\r\n]${attribute}=\"([^\"]*)\"")
+        set(${outVar} "${CMAKE_MATCH_1}" PARENT_SCOPE)
+        set(${foundVar} TRUE PARENT_SCOPE)
+    else()
+        set(${outVar} "" PARENT_SCOPE)
+        set(${foundVar} FALSE PARENT_SCOPE)
+    endif()
+endfunction()
+
+# XML 文本转 C++ 字符串字面量（与 QXmlStreamReader 一样解码预定义实体）
+function(cpp_literal text outVar)
+    string(REPLACE "&lt;" "<" text "${text}")
+    string(REPLACE "&gt;" ">" text "${text}")
+    string(REPLACE "&quot;" "\"" text "${text}")
+    string(REPLACE "&apos;" "'" text "${text}")
+    string(REPLACE "&amp;" "&" text "${text}")
+    string(REPLACE "\\" "\\\\" text "${text}")
+    string(REPLACE "\"" "\\\"" text "${text}")
+    string(REPLACE "\r" "" text "${text}")
+    string(REPLACE "\n" "\\n" text "${text}")
+    string(REPLACE "\t" "\\t" text "${text}")
+    set(${outVar} "\"${text}\"" PARENT_SCOPE)
+endfunction()
+
+function(strip_comments text outVar)
+    set(result "")
+    while(TRUE)
+        string(FIND "${text}" "<!--" begin)
+        if(begin EQUAL -1)
+            break()
+        endif()
+        string(SUBSTRING "${text}" 0 ${begin} head)
+        string(APPEND result "${head}")
+        string(SUBSTRING "${text}" ${begin} -1 text)
+        string(FIND "${text}" "-->" end)
+        if(end EQUAL -1)
+            set(text "")
+            break()
+        endif()
+        math(EXPR end "${end} + 3")
+        string(SUBSTRING "${text}" ${end} -1 text)
+    endwhile()
+    string(APPEND result "${text}")
+    set(${outVar} "${result}" PARENT_SCOPE)
+endfunction()
+
+# 取 text 中第一个匹配 pattern 的开始标签：tag 为标签文本，rest 为其后的内容
+function(next_tag text pattern tagVar restVar)
+    string(REGEX MATCH "${pattern}[^>]*>" tag "${text}")
+    if(tag STREQUAL "")
+        set(${tagVar} "" PARENT_SCOPE)
+        set(${restVar} "" PARENT_SCOPE)
+        return()
+    endif()
+    string(FIND "${text}" "${tag}" position)
+    string(LENGTH "${tag}" length)
+    math(EXPR position "${position} + ${length}")
+    string(SUBSTRING "${text}" ${position} -1 rest)
+    set(${tagVar} "${tag}" PARENT_SCOPE)
+    set(${restVar} "${rest}" PARENT_SCOPE)
+endfunction()
+
+# 截取到结束标签之前的内容；rest 为结束标签之后的内容
+function(element_body text endTag bodyVar restVar)
+    string(FIND "${text}" "${endTag}" end)
+    if(end EQUAL -1)
+        set(${bodyVar} "${text}" PARENT_SCOPE)
+        set(${restVar} "" PARENT_SCOPE)
+        return()
+    endif()
+    string(SUBSTRING "${text}" 0 ${end} body)
+    string(LENGTH "${endTag}" length)
+    math(EXPR end "${end} + ${length}")
+    string(SUBSTRING "${text}" ${end} -1 rest)
+    set(${bodyVar} "${body}" PARENT_SCOPE)
+    set(${restVar} "${rest}" PARENT_SCOPE)
+endfunction()
+
+set(commandNames "")
+set(messageRows "")
+set(fieldRows "")
+set(fieldCount 0)
+set(messageCount 0)
+set(source "ardupilotmega.xml")
+
+if(INPUT)
+    get_filename_component(source "${INPUT}" NAME)
+    file(READ "${INPUT}" xml)
+    strip_comments("${xml}" xml)
+
+    # MAV_CMD 枚举（可能分多段出现）
+    set(rest "${xml}")
+    while(TRUE)
+        next_tag("${rest}" "<enum[ \t\r\n][^>]*name=\"MAV_CMD\"" enumTag rest)
+        if(enumTag STREQUAL "")
+            break()
+        endif()
+        element_body("${rest}" "</enum>" entries rest)
+        while(TRUE)
+            next_tag("${entries}" "<entry[ \t\r\n]" entryTag entries)
+            if(entryTag STREQUAL "")
+                break()
+            endif()
+            set(entryBody "")
+            if(NOT entryTag MATCHES "/>$")
+                element_body("${entries}" "</entry>" entryBody entries)
+            endif()
+
+            xml_attribute("${entryTag}" name name found)
+            if(name STREQUAL "")
+                continue()
+            endif()
+            xml_attribute("${entryTag}" value value found)
+            if(NOT value MATCHES "^[0-9]+$" OR value GREATER 65535)
+                set(value 0)
+            endif()
+
+            set(description "")
+            string(FIND "${entryBody}" "<description>" begin)
+            if(NOT begin EQUAL -1)
+                math(EXPR begin "${begin} + 13")
+                string(SUBSTRING "${entryBody}" ${begin} -1 description)
+                element_body("${description}" "</description>" description unused)
+            endif()
+            cpp_literal("${description}" description)
+
+            set(params "")
+            set(paramCount 0)
+            set(paramRest "${entryBody}")
+            while(TRUE)
+                next_tag("${paramRest}" "<param[ \t\r\n>]" paramTag paramRest)
+                if(paramTag STREQUAL "")
+                    break()
+                endif()
+                xml_attribute("${paramTag}" index index found)
+                if(NOT index MATCHES "^-?[0-9]+$")
+                    set(index 0)
+                endif()
+                xml_attribute("${paramTag}" label label hasLabel)
+                if(NOT hasLabel)
+                    set(label "param${index}")
+                endif()
+                cpp_literal("${label}" label)
+                string(APPEND params "    {${index}, ${label}},\n")
+                math(EXPR paramCount "${paramCount} + 1")
+            endwhile()
+
+            if(NOT name IN_LIST commandNames)
+                list(APPEND commandNames "${name}")
+            endif()
+            set(command_${name}_value "${value}")
+            set(command_${name}_description "${description}")
+            set(command_${name}_params "${params}")
+            set(command_${name}_paramCount "${paramCount}")
+        endwhile()
+    endwhile()
+
+    # <messages>：字段按声明顺序输出，运行时再按线上顺序排布
+    set(rest "${xml}")
+    while(TRUE)
+        next_tag("${rest}" "<message[ \t\r\n]" messageTag rest)
+        if(messageTag STREQUAL "")
+            break()
+        endif()
+        element_body("${rest}" "</message>" fields rest)
+        xml_attribute("${messageTag}" name name found)
+        xml_attribute("${messageTag}" id id found)
+        if(name STREQUAL "" OR NOT id MATCHES "^[0-9]+$")
+            continue()
+        endif()
+        cpp_literal("${name}" name)
+
+        set(firstField ${fieldCount})
+        set(extension false)
+        while(TRUE)
+            next_tag("${fields}" "<(field|extensions)[ \t\r\n/>]" fieldTag fields)
+            if(fieldTag STREQUAL "")
+                break()
+            endif()
+            if(fieldTag MATCHES "^<extensions")
+                set(extension true)
+                continue()
+            endif()
+            xml_attribute("${fieldTag}" name fieldName found)
+            xml_attribute("${fieldTag}" type fieldType found)
+            cpp_literal("${fieldName}" fieldName)
+            cpp_literal("${fieldType}" fieldType)
+            string(APPEND fieldRows
+                   "    {${fieldName}, ${fieldType}, ${extension}},\n")
+            math(EXPR fieldCount "${fieldCount} + 1")
+        endwhile()
+        math(EXPR messageFields "${fieldCount} - ${firstField}")
+        string(APPEND messageRows
+               "    {${name}, ${id}u, ${firstField}, ${messageFields}},\n")
+        math(EXPR messageCount "${messageCount} + 1")
+    endwhile()
+endif()
+
+list(SORT commandNames)
+set(paramRows "")
+set(commandRows "")
+set(paramCount 0)
+list(LENGTH commandNames commandCount)
+foreach(name IN LISTS commandNames)
+    string(APPEND paramRows "${command_${name}_params}")
+    string(APPEND commandRows
+           "    {\"${name}\", ${command_${name}_value}, "
+           "${command_${name}_description}, ${paramCount}, "
+           "${command_${name}_paramCount}},\n")
+    math(EXPR paramCount "${paramCount} + ${command_${name}_paramCount}")
+endforeach()
+
+# 空数组写作 {}，非空写作 {{ ... }}
+function(array_initializer rows outVar)
+    if(rows STREQUAL "")
+        set(${outVar} "{}" PARENT_SCOPE)
+    else()
+        set(${outVar} "{{\n${rows}}}" PARENT_SCOPE)
+    endif()
+endfunction()
+array_initializer("${paramRows}" paramInit)
+array_initializer("${commandRows}" commandInit)
+array_initializer("${fieldRows}" fieldInit)
+array_initializer("${messageRows}" messageInit)
+
+if(INPUT)
+    set(available true)
+    file(SHA256 "${INPUT}" sourceSha256)
+else()
+    set(available false)
+    set(sourceSha256 "")
+endif()
+
+set(content "// 由 cmake/GenerateDialectCatalog.cmake 根据 ${source} 生成，请勿手工修改
+#ifndef MINIGCS_GENERATED_DEFAULTDIALECTCATALOG_H
+#define MINIGCS_GENERATED_DEFAULTDIALECTCATALOG_H
+
+#include \"Extern/DialectCatalog.h\"
+
+namespace DefaultDialectCatalog {
+
+using namespace DialectCatalog;
+
+inline constexpr bool Available = ${available};
+
+/// 生成目录所用 XML 原始字节的 SHA-256（小写十六进制）
+inline constexpr std::string_view SourceSha256 = \"${sourceSha256}\";
+
+inline constexpr std::array<Param, ${paramCount}> Params${paramInit};
+
+/// 按名称升序
+inline constexpr std::array<Command, ${commandCount}> Commands${commandInit};
+
+inline constexpr std::array<Field, ${fieldCount}> Fields${fieldInit};
+
+inline constexpr std::array<Message, ${messageCount}> Messages${messageInit};
+
+} // namespace DefaultDialectCatalog
+
+#endif // MINIGCS_GENERATED_DEFAULTDIALECTCATALOG_H
+")
+
+# 内容不变时不改写，避免触发重新编译
+if(EXISTS "${OUTPUT}")
+    file(READ "${OUTPUT}" previous)
+    if(previous STREQUAL content)
+        return()
+    endif()
+endif()
+file(WRITE "${OUTPUT}" "${content}")